@@ -88,7 +88,8 @@ def main():
     producer = Producer(KAFKA_CONF)
     for i in range(1):
         for e in graph():
-            producer.produce(TOPIC, key="a", value=json.dumps(e))
+            # Key by source vertex so all edges of a vertex keep their order
+            producer.produce(TOPIC, key=e["from"], value=json.dumps(e))
         producer.flush()
 
 
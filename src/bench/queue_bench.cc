@@ -0,0 +1,204 @@
+/*
+Stress and throughput check for the ingest queues.
+
+    ./src/build/queue_bench [elements per producer]
+
+Stress: producers push unique_ptrs to distinct values while consumers pop them, single and in batches. Every value
+must come out exactly once (count and checksum), and in order for SpscQueue. Exits with 1 if not. Worth running in
+sanitizer builds (-fsanitize=address or -fsanitize=thread).
+
+Throughput: the same with plain integers, reported in million elements per second.
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lock_free_queue.h"
+#include "../spsc_queue.h"
+
+namespace {
+
+constexpr size_t kCapacity = 1024;
+constexpr size_t kBatch = 32;
+
+struct Result {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    bool ordered = true;
+};
+
+// Value number `i` of `producer`, never 0
+uint64_t Value(size_t producer, size_t producers, size_t i) { return i * producers + producer + 1; }
+
+uint64_t ExpectedSum(size_t producers, size_t per_producer) {
+    uint64_t n = producers * per_producer;
+    return n * (n + 1) / 2;
+}
+
+// Alternates between kBatch single pushes and a batch of kBatch
+template <typename Queue>
+void Produce(Queue& queue, size_t producer, size_t producers, size_t per_producer) {
+    std::vector<std::unique_ptr<uint64_t>> batch;
+    for (size_t i = 0; i < per_producer;) {
+        if ((i / kBatch) % 2 == 0) {
+            auto value = std::make_unique<uint64_t>(Value(producer, producers, i));
+            while (!queue.TryPush(std::move(value))) {
+                std::this_thread::yield();
+            }
+            ++i;
+            continue;
+        }
+
+        for (; batch.size() < kBatch && i < per_producer; ++i) {
+            batch.push_back(std::make_unique<uint64_t>(Value(producer, producers, i)));
+        }
+        auto first = batch.begin();
+        while (first != batch.end()) {
+            size_t pushed = queue.TryPushBatch(first, batch.end());
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            first += pushed;
+        }
+        batch.clear();
+    }
+}
+
+// Alternates between single and batch pops. Stops once `total` elements were popped by all consumers.
+template <typename Queue>
+Result Consume(Queue& queue, std::atomic<uint64_t>& popped, uint64_t total) {
+    Result result;
+    uint64_t last = 0;
+    std::vector<std::unique_ptr<uint64_t>> batch;
+    auto take = [&](const std::unique_ptr<uint64_t>& value) {
+        ++result.count;
+        result.sum += *value;
+        result.ordered = result.ordered && *value > last;
+        last = *value;
+    };
+
+    bool single = true;
+    while (popped.load(std::memory_order_relaxed) < total) {
+        size_t n = 0;
+        single = !single;
+        if (single) {
+            std::unique_ptr<uint64_t> value;
+            if (queue.TryPop(value)) {
+                take(value);
+                n = 1;
+            }
+        } else {
+            n = queue.TryPopBatch(std::back_inserter(batch), kBatch);
+            for (const auto& value : batch) {
+                take(value);
+            }
+            batch.clear();
+        }
+
+        if (n == 0) {
+            std::this_thread::yield();
+        } else {
+            popped.fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+    return result;
+}
+
+template <typename Queue>
+bool Stress(const char* name, size_t producers, size_t consumers, size_t per_producer, bool check_order) {
+    Queue queue(kCapacity);
+    uint64_t total = producers * per_producer;
+    std::atomic<uint64_t> popped{0};
+    std::vector<Result> results(consumers);
+    std::vector<std::thread> threads;
+
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] { results[c] = Consume(queue, popped, total); });
+    }
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] { Produce(queue, p, producers, per_producer); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Result all;
+    for (const auto& result : results) {
+        all.count += result.count;
+        all.sum += result.sum;
+        all.ordered = all.ordered && result.ordered;
+    }
+    bool ok = all.count == total && all.sum == ExpectedSum(producers, per_producer) && queue.Size() == 0 &&
+              (!check_order || all.ordered);
+    std::printf("stress %-14s %zu producers %zu consumers: %llu elements, checksum %s%s\n", name, producers,
+                consumers, static_cast<unsigned long long>(all.count), ok ? "ok" : "MISMATCH",
+                check_order ? (all.ordered ? ", in order" : ", OUT OF ORDER") : "");
+    return ok;
+}
+
+template <typename Queue>
+void Throughput(const char* name, size_t producers, size_t consumers, size_t per_producer) {
+    Queue queue(kCapacity);
+    uint64_t total = producers * per_producer;
+    std::atomic<uint64_t> popped{0};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            uint64_t value;
+            while (popped.load(std::memory_order_relaxed) < total) {
+                if (queue.TryPop(value)) {
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (uint64_t i = 0; i < per_producer;) {
+                uint64_t value = i;
+                if (queue.TryPush(std::move(value))) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+    std::printf("throughput %-10s %zu producers %zu consumers: %.1f M elements/s\n", name, producers, consumers,
+                static_cast<double>(total) / seconds.count() / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t per_producer = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    size_t threads = std::max(2u, std::thread::hardware_concurrency() / 2);
+
+    bool ok = true;
+    ok &= Stress<LockFreeQueue<std::unique_ptr<uint64_t>>>("LockFreeQueue", threads, threads, per_producer, false);
+    ok &= Stress<LockFreeQueue<std::unique_ptr<uint64_t>>>("LockFreeQueue", 1, 1, per_producer, true);
+    ok &= Stress<SpscQueue<std::unique_ptr<uint64_t>>>("SpscQueue", 1, 1, per_producer, true);
+
+    Throughput<LockFreeQueue<uint64_t>>("LockFreeQueue", 1, 1, per_producer);
+    Throughput<LockFreeQueue<uint64_t>>("LockFreeQueue", threads, threads, per_producer);
+    Throughput<SpscQueue<uint64_t>>("SpscQueue", 1, 1, per_producer);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,75 @@
+#ifndef CHANNEL_POOL_H
+#define CHANNEL_POOL_H
+
+#include <grpc/grpc.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * A few channels to one server, each with a stub of the generated `Service` (e.g. graph::Graph). All calls of a
+ * channel share one HTTP/2 connection, which caps what heavy fan-out gets through to a single server. The pool's
+ * channels each keep a connection of their own and Next() hands out their stubs round robin.
+ *
+ * Channels connect lazily on their first call. Connect() starts that right away, so a cold cluster doesn't pay for
+ * the handshakes with its first queries.
+ **/
+template <typename Service>
+class ChannelPool {
+   public:
+    using Stub = typename Service::Stub;
+
+    ChannelPool(const std::string& address, size_t size) {
+        for (size_t i = 0; i < std::max<size_t>(size, 1); ++i) {
+            grpc::ChannelArguments args;
+            // Otherwise gRPC notices the channels go to the same address and has them share one connection
+            args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            std::shared_ptr<grpc::Channel> channel =
+                grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+            m_stubs.push_back(Service::NewStub(channel));
+            m_channels.push_back(std::move(channel));
+        }
+    }
+
+    ChannelPool(const ChannelPool&) = delete;
+    ChannelPool& operator=(const ChannelPool&) = delete;
+
+    // Thread safe, stubs may be used concurrently
+    Stub* Next() { return m_stubs[m_next.fetch_add(1, std::memory_order_relaxed) % m_stubs.size()].get(); }
+
+    // Starts connecting every channel without waiting for it
+    void Connect() {
+        for (const auto& channel : m_channels) {
+            channel->GetState(true);
+        }
+    }
+
+    // Connects every channel and waits until they are or `deadline` has passed. Returns how many are connected.
+    size_t WaitForConnected(std::chrono::system_clock::time_point deadline) {
+        Connect();
+        size_t connected = 0;
+        for (const auto& channel : m_channels) {
+            if (channel->WaitForConnected(deadline)) {
+                ++connected;
+            }
+        }
+        return connected;
+    }
+
+    size_t Size() const { return m_channels.size(); }
+
+   private:
+    std::vector<std::shared_ptr<grpc::Channel>> m_channels;
+    std::vector<std::unique_ptr<Stub>> m_stubs;
+    std::atomic<size_t> m_next{0};
+};
+
+#endif
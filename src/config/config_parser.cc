@@ -63,4 +63,12 @@ std::map<std::string, std::string> ConfigParser::Workers() { return config_for_k
 
 std::map<std::string, std::string> ConfigParser::kafka() { return config_for_key("kafka"); }
 
+std::map<std::string, std::string> ConfigParser::Ingest() { return config_for_key("ingest"); }
+
+std::map<std::string, std::string> ConfigParser::Replay() { return config_for_key("replay"); }
+
+std::map<std::string, std::string> ConfigParser::Executor() { return config_for_key("executor"); }
+
+std::map<std::string, std::string> ConfigParser::Log() { return config_for_key("logging"); }
+
 ConfigParser::~ConfigParser(){};
\ No newline at end of file
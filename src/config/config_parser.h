@@ -28,6 +28,10 @@ class ConfigParser {
     std::map<std::string, std::string> Server();
     std::map<std::string, std::string> Workers();
     std::map<std::string, std::string> kafka();
+    std::map<std::string, std::string> Ingest();
+    std::map<std::string, std::string> Replay();
+    std::map<std::string, std::string> Executor();
+    std::map<std::string, std::string> Log();
     ~ConfigParser();
 };
 #endif
\ No newline at end of file
@@ -1,18 +1,64 @@
 #ifndef DATA_SOURCE_H
 #define DATA_SOURCE_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 
+/**
+ * Something a ThreadDispatcher polls, on a thread of its own or on the shared Executor.
+ *
+ * Query() does one step of work and returns true if there is more waiting, in which case the dispatcher calls it
+ * again right away. Otherwise the dispatcher backs off, waiting longer after every idle step up to the poll interval,
+ * or until someone calls Notify() (e.g. a producer that just handed this source new data).
+ **/
 class DataSource {
+   private:
+    std::mutex m_ready_mutex;
+    std::condition_variable m_ready_cv;
+    std::atomic<bool> m_ready = false;
+    std::atomic<bool> m_sleeping = false;
+    std::function<void()> m_on_notify;
+
    protected:
     int m_poll_interval = 10;
-    virtual void Query() = 0;
+    virtual bool Query() = 0;
 
    public:
     virtual ~DataSource(){};
     int NextPollInterval() const { return m_poll_interval; }
-    void Poll() { this->Query(); }
+    bool Poll() { return this->Query(); }
     virtual void Stop() = 0;
+
+    /*
+    Wakes the dispatcher if it is waiting for this source. Cheap enough to call on every handoff: unless the
+    dispatcher is actually asleep it is just two atomic operations.
+    */
+    void Notify() {
+        m_ready.store(true);
+        if (m_sleeping.load()) {
+            std::lock_guard<std::mutex> lock(m_ready_mutex);
+            m_ready_cv.notify_one();
+        }
+        if (m_on_notify) {
+            m_on_notify();
+        }
+    }
+
+    // Also calls `callback` on every Notify(). For dispatchers that don't block in WaitReady, set before polling.
+    void OnNotify(std::function<void()> callback) { m_on_notify = std::move(callback); }
+
+    // Waits up to `timeout` for Notify(). Returns true if notified.
+    bool WaitReady(std::chrono::microseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_ready_mutex);
+        m_sleeping.store(true);
+        m_ready_cv.wait_for(lock, timeout, [this]() { return m_ready.load(); });
+        m_sleeping.store(false);
+        return m_ready.exchange(false);
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,247 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Work-stealing thread pool shared by everything in the process that has work to run in parallel: data sources (see
+ * ThreadDispatcher), the orchestrator's per-worker fan-out, the worker's remote search hops.
+ *
+ * Every thread owns a lane (a deque). Tasks posted from one of our threads go to its own lane, everything else is
+ * spread round robin. A thread takes from the front of its own lane and, once that is empty, steals from the back of
+ * the others, so a burst posted to one lane is spread over all threads without a central queue everyone fights over.
+ *
+ * Tasks never block on work completed off the pool, e.g. RPCs driven by the RpcScheduler. They start it with the
+ * callback form of Spawn() and the callback posts (or notifies) the next step, so a pool thread is never held by a
+ * call in flight.
+ **/
+class Executor {
+   public:
+    using Task = std::function<void()>;
+
+    /*
+    `threads` = 0 uses one thread per core. With `pin_threads` thread i is pinned to core i % cores (Linux only),
+    which keeps lanes and the data they touch on one core's caches.
+    */
+    explicit Executor(size_t threads = 0, bool pin_threads = false) {
+        size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        if (threads == 0) {
+            threads = cores;
+        }
+
+        for (size_t i = 0; i < threads; ++i) {
+            m_lanes.emplace_back(std::make_unique<Lane>());
+        }
+        for (size_t i = 0; i < threads; ++i) {
+            m_threads.emplace_back(&Executor::Run, this, i);
+#ifdef __linux__
+            if (pin_threads) {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                CPU_SET(i % cores, &cpus);
+                pthread_setaffinity_np(m_threads.back().native_handle(), sizeof(cpus), &cpus);
+            }
+#endif
+        }
+        m_timer_thread = std::thread(&Executor::RunTimers, this);
+    }
+
+    /*
+    Runs whatever is still queued, then joins. Delayed tasks that aren't due yet are dropped. Destroy it after
+    everything that posts to it, i.e. declare it first.
+    */
+    ~Executor() {
+        {
+            std::lock_guard<std::mutex> lock(m_idle_mutex);
+            m_stop.store(true);
+        }
+        m_idle_cv.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(m_timer_mutex);
+        }
+        m_timer_cv.notify_all();
+
+        m_timer_thread.join();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    size_t Size() const { return m_threads.size(); }
+
+    // Fire and forget. Exceptions escaping `task` are reported and swallowed.
+    void Post(Task task) {
+        size_t lane = t_owner == this ? t_lane : m_next_lane.fetch_add(1, std::memory_order_relaxed) % m_lanes.size();
+        {
+            std::lock_guard<std::mutex> lock(m_lanes[lane]->mutex);
+            m_lanes[lane]->tasks.push_back(std::move(task));
+        }
+        m_pending.fetch_add(1);
+
+        // Only pay for the mutex if someone is actually asleep
+        if (m_sleeping.load() > 0) {
+            std::lock_guard<std::mutex> lock(m_idle_mutex);
+            m_idle_cv.notify_one();
+        }
+    }
+
+    /*
+    Runs `f` on the pool. Its result (or exception) is delivered through the future. Don't wait for it from a task on
+    the pool: if all threads wait for such futures, nothing is left to run them.
+    */
+    template <typename F>
+    auto Submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        std::future<Result> future = task->get_future();
+        Post([task]() { (*task)(); });
+        return future;
+    }
+
+    // Posts `task` once `delay` has passed.
+    void PostAfter(std::chrono::microseconds delay, Task task) {
+        {
+            std::lock_guard<std::mutex> lock(m_timer_mutex);
+            m_timers.push({std::chrono::steady_clock::now() + delay, m_timer_sequence++, std::move(task)});
+        }
+        m_timer_cv.notify_one();
+    }
+
+   private:
+    struct alignas(64) Lane {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    struct Timer {
+        std::chrono::steady_clock::time_point due;
+        size_t sequence;  // FIFO among timers due at the same time
+        Task task;
+
+        bool operator>(const Timer& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    std::vector<std::unique_ptr<Lane>> m_lanes;
+    std::vector<std::thread> m_threads;
+    std::atomic<size_t> m_next_lane{0};
+    std::atomic<size_t> m_pending{0};
+    std::atomic<size_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+    std::mutex m_idle_mutex;
+    std::condition_variable m_idle_cv;
+
+    std::thread m_timer_thread;
+    std::mutex m_timer_mutex;
+    std::condition_variable m_timer_cv;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> m_timers;
+    size_t m_timer_sequence = 0;
+
+    // The executor and lane of the calling thread, if it is one of ours
+    static inline thread_local const Executor* t_owner = nullptr;
+    static inline thread_local size_t t_lane = 0;
+
+    // Front of our own lane first, then the back of everyone else's
+    bool Take(size_t home, Task& task) {
+        if (m_pending.load() == 0) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_lanes.size(); ++i) {
+            Lane& lane = *m_lanes[(home + i) % m_lanes.size()];
+            std::lock_guard<std::mutex> lock(lane.mutex);
+            if (lane.tasks.empty()) {
+                continue;
+            }
+            if (i == 0) {
+                task = std::move(lane.tasks.front());
+                lane.tasks.pop_front();
+            } else {
+                task = std::move(lane.tasks.back());
+                lane.tasks.pop_back();
+            }
+            m_pending.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+
+    static void Execute(Task& task) {
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "Executor task failed: " << e.what() << std::endl;
+        }
+    }
+
+    void Run(size_t lane) {
+        t_owner = this;
+        t_lane = lane;
+
+        Task task;
+        for (;;) {
+            if (Take(lane, task)) {
+                Execute(task);
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_idle_mutex);
+            m_sleeping.fetch_add(1);
+            m_idle_cv.wait(lock, [this]() { return m_pending.load() > 0 || m_stop.load(); });
+            m_sleeping.fetch_sub(1);
+            if (m_stop.load() && m_pending.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    void RunTimers() {
+        std::unique_lock<std::mutex> lock(m_timer_mutex);
+        while (!m_stop.load()) {
+            if (m_timers.empty()) {
+                m_timer_cv.wait(lock);
+                continue;
+            }
+
+            auto due = m_timers.top().due;
+            if (std::chrono::steady_clock::now() < due) {
+                m_timer_cv.wait_until(lock, due);
+                continue;
+            }
+
+            Task task = std::move(const_cast<Timer&>(m_timers.top()).task);
+            m_timers.pop();
+            lock.unlock();
+            Post(std::move(task));
+            lock.lock();
+        }
+    }
+};
+
+#endif
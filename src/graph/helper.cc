@@ -10,7 +10,7 @@
 #include <vector>
 
 #include "../config/config_parser.h"
-#include "../grpc/graph.grpc.pb.h"
+#include "graph.grpc.pb.h"
 #include "in_memory_graph.h"
 namespace graph {
 
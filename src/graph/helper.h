@@ -22,7 +22,7 @@
 #include <string>
 #include <vector>
 
-#include "../grpc/graph.grpc.pb.h"
+#include "graph.grpc.pb.h"
 
 template <typename VERTEX_DATA, typename EDGE_DATA>
 class InMemoryGraph;
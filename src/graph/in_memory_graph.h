@@ -1,14 +1,21 @@
 #ifndef IN_MEMORY_GRAPH_H_
 #define IN_MEMORY_GRAPH_H_
 
+#include <future>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <queue>
 #include <set>
+#include <shared_mutex>
+#include <utility>
 #include <vector>
 
-#include "../grpc/graph.grpc.pb.h"
+#include "graph.grpc.pb.h"
+#include "../rpc_scheduler.h"
+#include "../task.h"
 #include "../worker/worker_graph_client.h"
+#include "search_results.h"
 
 template <typename VERTEX_DATA, typename EDGE_DATA>
 class InMemoryGraph {
@@ -44,11 +51,20 @@ class InMemoryGraph {
     std::map<VERTEX_KEY, std::set<InMemoryEdge>> edges_;
     std::string worker_id_;
     std::map<std::string, std::unique_ptr<graph::Graph::Stub>> worker_clients_;
+    /*
+    RPC handlers run concurrently. Writers take it exclusively, Search shares it but only while it reads local
+    adjacency, never across a remote hop (which may call back into this worker).
+    */
+    mutable std::shared_mutex mutex_;
 
    public:
     InMemoryGraph(std::string id) : worker_id_(id) {}
-    int NumberOfVertices() const { return vertices_.size(); }
+    int NumberOfVertices() const {
+        std::shared_lock lock(mutex_);
+        return vertices_.size();
+    }
     int NumberOfEdges() const {
+        std::shared_lock lock(mutex_);
         int count = 0;
         for (const auto& [key, value] : edges_) {
             count += value.size();
@@ -63,45 +79,48 @@ class InMemoryGraph {
 
     bool HasVertex(VERTEX_KEY key) { return (vertices_.find(key) != vertices_.end()); }
 
+    // Snapshot of all vertex keys, without their data
+    std::vector<VERTEX_KEY> Keys() const {
+        std::shared_lock lock(mutex_);
+        std::vector<VERTEX_KEY> keys;
+        keys.reserve(vertices_.size());
+        for (const auto& [key, vertex] : vertices_) {
+            keys.push_back(key);
+        }
+        return keys;
+    }
+
+    /*
+    Writes hold the exclusive lock, so nothing that grows with the graph (like print_edges()) or waits on the console
+    happens while they do. Ingest adds missing edge targets through here, one call per target.
+    */
     void AddVertex(VERTEX_KEY key, const VERTEX_DATA& data) {
         std::cout << "[AddVertex] Adding vertex: '" << key << "' with data: '" << data << "'" << std::endl;
-        std::cout << "[AddVertex] Available edges before add:" << std::endl;
-        print_edges();
-
-        if (this->HasVertex(key)) {
-            std::cerr << "[AddVertex] Vertex with key: '" << key << "' already exists" << std::endl;
-            return;
+        {
+            std::unique_lock lock(mutex_);
+            if (!this->HasVertex(key)) {
+                vertices_.insert({key, InMemoryVertex(key, data)});
+                edges_.insert({key, std::set<InMemoryEdge>()});
+                return;
+            }
         }
-
-        assert(vertices_.find(key) == vertices_.end());
-        vertices_.insert({key, InMemoryVertex(key, data)});
-        edges_.insert({key, std::set<InMemoryEdge>()});
-
-        std::cout << "[AddVertex] Available edges after add:" << std::endl;
-        print_edges();
+        std::cerr << "[AddVertex] Vertex with key: '" << key << "' already exists" << std::endl;
     }
 
     void DeleteVertex(VERTEX_KEY key) {
         std::cout << "[DeleteVertex] Deleting vertex: '" << key << "'" << std::endl;
-        std::cout << "[DeleteVertex] Available edges before delete:" << std::endl;
-        print_edges();
-
-        if (!this->HasVertex(key)) {
-            std::cerr << "[DeleteVertex] Vertex with key: '" << key << "' does not exist" << std::endl;
-            return;
+        {
+            std::unique_lock lock(mutex_);
+            if (this->HasVertex(key)) {
+                vertices_.erase(vertices_.find(key));
+                edges_.erase(edges_.find(key));
+                return;
+            }
         }
-
-        assert(vertices_.find(key) != vertices_.end());
-        const auto it_v = vertices_.find(key);
-        vertices_.erase(it_v);
-
-        const auto it_e = edges_.find(key);
-        edges_.erase(it_e);
-
-        std::cout << "[DeleteVertex] Available edges after delete:" << std::endl;
-        print_edges();
+        std::cerr << "[DeleteVertex] Vertex with key: '" << key << "' does not exist" << std::endl;
     }
 
+    // Dumps every edge. Debugging only, the caller holds the lock.
     void print_edges() {
         for (const auto& [key, to_edges] : edges_) {
             for (const auto& to_edge : to_edges) {
@@ -114,44 +133,54 @@ class InMemoryGraph {
     void AddEdge(VERTEX_KEY from, VERTEX_KEY to, const EDGE_DATA& data, const std::string lookup_to) {
         std::cout << "[AddEdge] Adding edge: '" << from << "'-'" << to << "' with data: '" << data
                   << "' and lookup_to: '" << lookup_to << "'" << std::endl;
-        std::cout << "[AddEdge] Available edges before add:" << std::endl;
-        print_edges();
-
-        if (!this->HasVertex(from)) {
-            std::cerr << "[AddEdge] Vertex with key: '" << from << "' does not exist" << std::endl;
-            return;
+        {
+            std::unique_lock lock(mutex_);
+            if (this->HasVertex(from)) {
+                assert(edges_.find(from) != edges_.end());
+                edges_[from].emplace(InMemoryEdge(to, data, lookup_to));
+                return;
+            }
         }
-
-        assert(edges_.find(from) != edges_.end());
-        edges_[from].emplace(InMemoryEdge(to, data, lookup_to));
-
-        std::cout << "[AddEdge] Available edges after add:" << std::endl;
-        print_edges();
+        std::cerr << "[AddEdge] Vertex with key: '" << from << "' does not exist" << std::endl;
     }
 
     void DeleteEdge(VERTEX_KEY from, VERTEX_KEY to) {
         std::cout << "[DeleteEdge] Attempting to delete edge: '" << from << "'-'" << to << "'" << std::endl;
-        std::cout << "[DeleteEdge] Available edges before delete:" << std::endl;
-        print_edges();
-
-        if (edges_.find(from) == edges_.end()) {
-            std::cerr << "[DeleteEdge] Edge: '" << from << "'-'" << to << "' not available" << std::endl;
-            return;
-        }
-
-        assert(edges_.find(from) != edges_.end());
-        std::set<InMemoryEdge> edges = edges_.find(from)->second;
-        typename std::set<InMemoryEdge>::iterator it_e;
-        for (it_e = edges.begin(); it_e != edges.end();) {
-            if (!to.compare(it_e->to_)) {
-                it_e = edges.erase(it_e);
-            } else {
-                ++it_e;
+        {
+            std::unique_lock lock(mutex_);
+            auto it_from = edges_.find(from);
+            if (it_from != edges_.end()) {
+                std::set<InMemoryEdge>& edges = it_from->second;
+                typename std::set<InMemoryEdge>::iterator it_e;
+                for (it_e = edges.begin(); it_e != edges.end();) {
+                    if (!to.compare(it_e->to_)) {
+                        it_e = edges.erase(it_e);
+                    } else {
+                        ++it_e;
+                    }
+                }
+                return;
             }
         }
+        std::cerr << "[DeleteEdge] Edge: '" << from << "'-'" << to << "' not available" << std::endl;
+    }
 
-        std::cout << "[DeleteEdge] Available edges after delete:" << std::endl;
-        print_edges();
+    /*
+    Adds the edge and creates whichever endpoint is missing, all under one lock so no reader sees the edge without its
+    source. `from` always lives on this worker, `to` only if `lookup_to` says so. Missing vertices get their key as
+    data, like ingested vertices do. Unlike AddEdge this doesn't depend on the vertices arriving first.
+    */
+    void UpsertEdge(VERTEX_KEY from, VERTEX_KEY to, const EDGE_DATA& data, const std::string& lookup_to) {
+        std::unique_lock lock(mutex_);
+        if (vertices_.find(from) == vertices_.end()) {
+            vertices_.insert({from, InMemoryVertex(from, from)});
+            edges_.insert({from, std::set<InMemoryEdge>()});
+        }
+        if (IsLocal(lookup_to) && vertices_.find(to) == vertices_.end()) {
+            vertices_.insert({to, InMemoryVertex(to, to)});
+            edges_.insert({to, std::set<InMemoryEdge>()});
+        }
+        edges_[from].emplace(InMemoryEdge(to, data, lookup_to));
     }
 
     void AddUndirectedEdge(VERTEX_KEY from, VERTEX_KEY to, const EDGE_DATA& data, const std::string lookup_to,
@@ -162,37 +191,53 @@ class InMemoryGraph {
 
     bool IsLocal(const std::string& data_source) { return !worker_id_.compare(data_source); }
 
-    void Search(std::string key, int max_level, std::set<graph::Vertex>& result_nodes,
-                std::set<graph::Edge>& result_edges, std::set<std::string>& ids_so_far,
-                const std::map<std::string, WorkerGraphClient>& rpc_clients) {
-        if (!this->HasVertex(key)) {
-            std::cout << "Vertex with key '" << key << "' is not in this graph" << std::endl;
-            return;
-        }
-
+    using SearchStarts = std::vector<std::pair<VERTEX_KEY, int>>;
+
+    /*
+    BFS from every key of `starts`, each up to the number of levels given with it. The local part of the graph is
+    walked first. Vertices owned by other workers are collected on the way and searched afterwards, all at once
+    through `scheduler`, one search per worker starting from all the vertices it owns, each with the levels left at
+    that vertex. No thread waits for them, the search resumes on one of the scheduler's threads once the last one is
+    back. Vertices and edges go straight into `results`, including those of the remote searches. `results`,
+    `ids_so_far` and `rpc_clients` must outlive the task.
+    */
+    Task<void> Search(SearchStarts starts, graph::SearchResultBuilder& results, std::set<std::string>& ids_so_far,
+                      const std::map<std::string, WorkerGraphClient>& rpc_clients, RpcScheduler& scheduler) {
         struct BFSEntry {
             VERTEX_KEY key_;
-            int level_;
+            int levels_left_;
             std::string data_source_;
+
+            // Most levels left first, so a vertex reachable from several starts is expanded as far as any allows
+            bool operator<(const BFSEntry& o) const { return levels_left_ < o.levels_left_; }
         };
 
-        ids_so_far.insert(key);
+        std::priority_queue<BFSEntry> q;
+        {
+            std::shared_lock lock(mutex_);
+            for (auto& [key, levels] : starts) {
+                if (!this->HasVertex(key)) {
+                    std::cout << "Vertex with key '" << key << "' is not in this graph" << std::endl;
+                    continue;
+                }
+                ids_so_far.insert(key);
+                q.push({std::move(key), levels, worker_id_});
+            }
+        }
 
-        std::queue<BFSEntry> q;
-        q.push({key, 0, worker_id_});
+        std::map<std::string, SearchStarts> remote_hops;  // by worker
 
         while (!q.empty()) {
-            const auto queue_entry = q.front();
+            const auto queue_entry = q.top();
             q.pop();
             const auto current_key = queue_entry.key_;
-            const auto current_level = queue_entry.level_;
+            const auto levels_left = queue_entry.levels_left_;
             const auto data_source = queue_entry.data_source_;
             if (IsLocal(data_source)) {
-                graph::Vertex rpc_vertex;
-                rpc_vertex.set_key(current_key);
-                result_nodes.insert(rpc_vertex);
+                std::shared_lock lock(mutex_);
+                results.AddVertex(current_key);
 
-                if (current_level < max_level) {
+                if (levels_left > 0) {
                     // Iterate over its adjacent vertices
 
                     for (typename InMemoryGraph<std::string, std::string>::AdjacencyIterator e =
@@ -202,36 +247,50 @@ class InMemoryGraph {
                         const auto& to_key = e.To();
                         const auto& label = e.Data();
                         const auto& lookup_to = e.LookupTo();
-                        std::string edge_key;
-                        if (to_key.compare(current_key) < 0) {
-                            edge_key.assign(to_key + label + current_key);
-                        } else {
-                            edge_key.assign(current_key + label + to_key);
-                        }
-                        graph::Edge rpc_edge;
-                        rpc_edge.set_key(edge_key);
-                        rpc_edge.set_from(current_key);
-                        rpc_edge.set_to(to_key);
-                        rpc_edge.set_label(label);
-                        rpc_edge.set_lookup_from(worker_id_);
-                        rpc_edge.set_lookup_to(lookup_to);
-
-                        result_edges.insert(rpc_edge);
+                        results.AddEdge(current_key, to_key, label, worker_id_, lookup_to);
 
                         if (ids_so_far.find(to_key) == ids_so_far.end()) {
                             ids_so_far.insert(to_key);
-                            q.push({to_key, current_level + 1, lookup_to});
+                            q.push({to_key, levels_left - 1, lookup_to});
                         }
                     }
                 }
 
-            } else {
-                int new_max_level = max_level - current_level;
-                if (new_max_level >= 0) {
-                    rpc_clients.at(data_source)
-                        .Search(current_key, new_max_level, result_nodes, result_edges, ids_so_far);
-                }
+            } else if (levels_left >= 0) {
+                remote_hops[data_source].emplace_back(current_key, levels_left);
+            }
+        }
+
+        if (remote_hops.empty()) {
+            co_return;
+        }
+
+        /*
+        Every worker gets a results message of its own on the search's arena and a copy of everything visited so far,
+        including the vertices handed to the other workers, so they can run concurrently. What the workers only reach
+        on the way may still overlap, merging drops the duplicates.
+        */
+        std::vector<graph::SearchResults*> hop_results;
+        std::vector<std::set<std::string>> hop_ids(remote_hops.size(), ids_so_far);
+        std::vector<Task<bool>> hops;
+        size_t i = 0;
+        for (auto& [worker, hop_starts] : remote_hops) {
+            auto client = rpc_clients.find(worker);
+            if (client == rpc_clients.end()) {
+                // Not added yet (AddHost), same as a hop that failed
+                std::cerr << "Search hop to unknown worker '" << worker << "' skipped." << std::endl;
+                continue;
             }
+            hop_results.push_back(results.Create<graph::SearchResults>());
+            hops.emplace_back(
+                client->second.SearchAsync(std::move(hop_starts), results.Undirected(), *hop_results[i], hop_ids[i],
+                                           scheduler));
+            ++i;
+        }
+        co_await WhenAll(std::move(hops));
+        for (i = 0; i < hop_results.size(); ++i) {
+            results.Merge(*hop_results[i]);
+            ids_so_far.merge(hop_ids[i]);
         }
     }
 
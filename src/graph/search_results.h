@@ -0,0 +1,225 @@
+#ifndef SEARCH_RESULTS_H_
+#define SEARCH_RESULTS_H_
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/repeated_field.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "graph.pb.h"
+
+namespace graph {
+
+/*
+Arena settings for search messages. Blocks grow up to 1 MiB, so even results with millions of vertices and edges take
+a few dozen allocations.
+*/
+inline google::protobuf::ArenaOptions SearchArenaOptions() {
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = 4 * 1024;
+    options.max_block_size = 1024 * 1024;
+    return options;
+}
+
+/*
+The key of an edge in search results: from, label and to. In an `undirected` graph every edge is stored as both
+halves, so there the endpoint that sorts first comes first and an edge and its reverse are the same edge to a search.
+*/
+inline std::string EdgeKey(std::string_view from, std::string_view to, std::string_view label, bool undirected) {
+    if (undirected && to.compare(from) < 0) {
+        std::swap(from, to);
+    }
+    std::string key;
+    key.reserve(from.size() + label.size() + to.size());
+    key.append(from).append(label).append(to);
+    return key;
+}
+
+inline std::string EdgeKey(const SearchResults& results, const SearchEdge& edge, bool undirected) {
+    return EdgeKey(results.keys(edge.from()), results.keys(edge.to()), results.labels(edge.label()), undirected);
+}
+
+// Whether every index in `results` is within its table. Check responses before reading them.
+inline bool IsValid(const SearchResults& results) {
+    auto in = [](uint32_t index, int size) { return index < static_cast<uint32_t>(size); };
+    for (uint32_t v : results.vertices()) {
+        if (!in(v, results.keys_size())) {
+            return false;
+        }
+    }
+    for (uint32_t v : results.ids_so_far()) {
+        if (!in(v, results.keys_size())) {
+            return false;
+        }
+    }
+    for (const auto& e : results.edges()) {
+        if (!in(e.from(), results.keys_size()) || !in(e.to(), results.keys_size()) ||
+            !in(e.label(), results.labels_size()) || !in(e.lookup_from(), results.workers_size()) ||
+            !in(e.lookup_to(), results.workers_size())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Builds the results of one search right in the response message. Every vertex and edge is added once, an edge once
+ * per EdgeKey(), see SetUndirected(). Vertex keys, labels and worker addresses go into the tables of the response once each and vertices
+ * and edges refer to them by index, see SearchResults in graph.proto.
+ *
+ * The response and everything else of the search (request, results of remote hops) live on one arena that is freed in
+ * one go with the builder.
+ **/
+class SearchResultBuilder {
+   public:
+    SearchResultBuilder()
+        : m_arena(SearchArenaOptions()), m_results(google::protobuf::Arena::CreateMessage<SearchResults>(&m_arena)) {}
+
+    SearchResultBuilder(const SearchResultBuilder&) = delete;
+    SearchResultBuilder& operator=(const SearchResultBuilder&) = delete;
+
+    // A new message on the builder's arena, freed with it
+    template <typename Message>
+    Message* Create() {
+        return google::protobuf::Arena::CreateMessage<Message>(&m_arena);
+    }
+
+    // Whether both halves of an edge are one edge, see EdgeKey(). Set it before adding edges.
+    void SetUndirected(bool undirected) { m_undirected = undirected; }
+    bool Undirected() const { return m_undirected; }
+
+    // Adds the vertex with `key` unless it is in already. Returns whether it was added.
+    bool AddVertex(std::string_view key) { return AddVertex(Intern(key, m_keys, *m_results->mutable_keys())); }
+
+    // Adds the edge unless one with the same EdgeKey() is in already. Returns whether it was added.
+    bool AddEdge(std::string_view from, std::string_view to, std::string_view label, std::string_view lookup_from,
+                 std::string_view lookup_to) {
+        return AddEdge(Intern(from, m_keys, *m_results->mutable_keys()), Intern(to, m_keys, *m_results->mutable_keys()),
+                       Intern(label, m_labels, *m_results->mutable_labels()),
+                       Intern(lookup_from, m_workers, *m_results->mutable_workers()),
+                       Intern(lookup_to, m_workers, *m_results->mutable_workers()));
+    }
+
+    void Add(const Vertex& v) { AddVertex(v.key()); }
+
+    void Add(const Edge& e) { AddEdge(e.from(), e.to(), e.label(), e.lookup_from(), e.lookup_to()); }
+
+    /*
+    Adds the vertices and edges of `other` that aren't in yet, leaving `other` empty. The strings of its tables are
+    moved, not copied. `other` must be valid, see IsValid().
+    */
+    void Merge(SearchResults& other) {
+        std::vector<uint32_t> keys = InternAll(*other.mutable_keys(), m_keys, *m_results->mutable_keys());
+        std::vector<uint32_t> labels = InternAll(*other.mutable_labels(), m_labels, *m_results->mutable_labels());
+        std::vector<uint32_t> workers = InternAll(*other.mutable_workers(), m_workers, *m_results->mutable_workers());
+        for (uint32_t v : other.vertices()) {
+            AddVertex(keys[v]);
+        }
+        for (const auto& e : other.edges()) {
+            AddEdge(keys[e.from()], keys[e.to()], labels[e.label()], workers[e.lookup_from()],
+                    workers[e.lookup_to()]);
+        }
+        other.Clear();
+    }
+
+    SearchResults& Results() { return *m_results; }
+
+   private:
+    // Index of every string in a table of the results. Keys are views of the strings in the results themselves.
+    using Table = std::unordered_map<std::string_view, uint32_t>;
+
+    // An edge's endpoints, in order of their index if the graph is undirected, see AddEdge()
+    struct EdgeId {
+        uint32_t first;
+        uint32_t second;
+        uint32_t label;
+
+        bool operator==(const EdgeId& other) const {
+            return first == other.first && second == other.second && label == other.label;
+        }
+    };
+
+    struct EdgeIdHash {
+        size_t operator()(const EdgeId& id) const {
+            uint64_t h = (static_cast<uint64_t>(id.first) << 32) | id.second;
+            return std::hash<uint64_t>()(h * 31 + id.label);
+        }
+    };
+
+    google::protobuf::Arena m_arena;
+    SearchResults* m_results;  // on m_arena
+    Table m_keys;
+    Table m_labels;
+    Table m_workers;
+    std::unordered_set<uint32_t> m_vertices;
+    std::unordered_set<EdgeId, EdgeIdHash> m_edges;
+    bool m_undirected = false;
+
+    bool AddVertex(uint32_t key) {
+        if (!m_vertices.insert(key).second) {
+            return false;
+        }
+        m_results->add_vertices(key);
+        return true;
+    }
+
+    bool AddEdge(uint32_t from, uint32_t to, uint32_t label, uint32_t lookup_from, uint32_t lookup_to) {
+        EdgeId id = m_undirected ? EdgeId{std::min(from, to), std::max(from, to), label} : EdgeId{from, to, label};
+        if (!m_edges.insert(id).second) {
+            return false;
+        }
+        SearchEdge* edge = m_results->add_edges();
+        edge->set_from(from);
+        edge->set_to(to);
+        edge->set_label(label);
+        edge->set_lookup_from(lookup_from);
+        edge->set_lookup_to(lookup_to);
+        return true;
+    }
+
+    // Index of `value` in `strings`, appending it if it isn't in yet
+    static uint32_t Intern(std::string_view value, Table& table,
+                           google::protobuf::RepeatedPtrField<std::string>& strings) {
+        auto it = table.find(value);
+        if (it != table.end()) {
+            return it->second;
+        }
+        uint32_t index = static_cast<uint32_t>(strings.size());
+        std::string* added = strings.Add();
+        added->assign(value.data(), value.size());
+        table.emplace(*added, index);
+        return index;
+    }
+
+    // Our index of every string in `from`. The new strings are moved over to `strings`.
+    static std::vector<uint32_t> InternAll(google::protobuf::RepeatedPtrField<std::string>& from, Table& table,
+                                           google::protobuf::RepeatedPtrField<std::string>& strings) {
+        std::vector<uint32_t> indices;
+        indices.reserve(from.size());
+        for (std::string& value : from) {
+            auto it = table.find(value);
+            if (it != table.end()) {
+                indices.push_back(it->second);
+                continue;
+            }
+            uint32_t index = static_cast<uint32_t>(strings.size());
+            std::string* added = strings.Add();
+            added->swap(value);
+            table.emplace(*added, index);
+            indices.push_back(index);
+        }
+        return indices;
+    }
+};
+
+}  // namespace graph
+
+#endif
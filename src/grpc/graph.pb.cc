@@ -1,2528 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: graph.proto
-
-#include "graph.pb.h"
-
-#include <algorithm>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::PROTOBUF_NAMESPACE_ID;
-namespace _pbi = ::PROTOBUF_NAMESPACE_ID::internal;
-namespace graph {
-template <typename>
-PROTOBUF_CONSTEXPR Host::Host(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.key_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.address_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct HostDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR HostDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~HostDefaultTypeInternal() {}
-  union {
-    Host _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HostDefaultTypeInternal _Host_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR Vertex::Vertex(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.key_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.value_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct VertexDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR VertexDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~VertexDefaultTypeInternal() {}
-  union {
-    Vertex _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VertexDefaultTypeInternal _Vertex_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR Edge::Edge(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.from_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.to_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.label_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.lookup_from_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.lookup_to_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.key_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct EdgeDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR EdgeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~EdgeDefaultTypeInternal() {}
-  union {
-    Edge _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDefaultTypeInternal _Edge_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR GraphSummary::GraphSummary(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.vertex_count_)*/ 0
-
-  , /*decltype(_impl_.edge_count_)*/ 0
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct GraphSummaryDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GraphSummaryDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GraphSummaryDefaultTypeInternal() {}
-  union {
-    GraphSummary _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GraphSummaryDefaultTypeInternal _GraphSummary_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR SearchArgs::SearchArgs(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.vertices_)*/{}
-  , /*decltype(_impl_.edges_)*/{}
-  , /*decltype(_impl_.ids_so_far_)*/{}
-  , /*decltype(_impl_.start_key_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_.level_)*/ 0
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct SearchArgsDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchArgsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchArgsDefaultTypeInternal() {}
-  union {
-    SearchArgs _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchArgsDefaultTypeInternal _SearchArgs_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR SearchResults::SearchResults(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.vertices_)*/{}
-  , /*decltype(_impl_.edges_)*/{}
-  , /*decltype(_impl_.ids_so_far_)*/{}
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct SearchResultsDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchResultsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchResultsDefaultTypeInternal() {}
-  union {
-    SearchResults _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchResultsDefaultTypeInternal _SearchResults_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR PingRequest::PingRequest(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.data_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct PingRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PingRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PingRequestDefaultTypeInternal() {}
-  union {
-    PingRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingRequestDefaultTypeInternal _PingRequest_default_instance_;
-template <typename>
-PROTOBUF_CONSTEXPR PingResponse::PingResponse(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.data_)*/ {
-    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
-  }
-
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct PingResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PingResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PingResponseDefaultTypeInternal() {}
-  union {
-    PingResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingResponseDefaultTypeInternal _PingResponse_default_instance_;
-}  // namespace graph
-static ::_pb::Metadata file_level_metadata_graph_2eproto[8];
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_graph_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_graph_2eproto = nullptr;
-const ::uint32_t TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
-    protodesc_cold) = {
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::Host, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::Host, _impl_.key_),
-    PROTOBUF_FIELD_OFFSET(::graph::Host, _impl_.address_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::Vertex, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::Vertex, _impl_.key_),
-    PROTOBUF_FIELD_OFFSET(::graph::Vertex, _impl_.value_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.from_),
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.to_),
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.label_),
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.lookup_from_),
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.lookup_to_),
-    PROTOBUF_FIELD_OFFSET(::graph::Edge, _impl_.key_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::GraphSummary, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::GraphSummary, _impl_.vertex_count_),
-    PROTOBUF_FIELD_OFFSET(::graph::GraphSummary, _impl_.edge_count_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _impl_.start_key_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _impl_.level_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _impl_.vertices_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _impl_.edges_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchArgs, _impl_.ids_so_far_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::SearchResults, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::SearchResults, _impl_.vertices_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchResults, _impl_.edges_),
-    PROTOBUF_FIELD_OFFSET(::graph::SearchResults, _impl_.ids_so_far_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::PingRequest, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::PingRequest, _impl_.data_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::graph::PingResponse, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::graph::PingResponse, _impl_.data_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-        { 0, -1, -1, sizeof(::graph::Host)},
-        { 10, -1, -1, sizeof(::graph::Vertex)},
-        { 20, -1, -1, sizeof(::graph::Edge)},
-        { 34, -1, -1, sizeof(::graph::GraphSummary)},
-        { 44, -1, -1, sizeof(::graph::SearchArgs)},
-        { 57, -1, -1, sizeof(::graph::SearchResults)},
-        { 68, -1, -1, sizeof(::graph::PingRequest)},
-        { 77, -1, -1, sizeof(::graph::PingResponse)},
-};
-
-static const ::_pb::Message* const file_default_instances[] = {
-    &::graph::_Host_default_instance_._instance,
-    &::graph::_Vertex_default_instance_._instance,
-    &::graph::_Edge_default_instance_._instance,
-    &::graph::_GraphSummary_default_instance_._instance,
-    &::graph::_SearchArgs_default_instance_._instance,
-    &::graph::_SearchResults_default_instance_._instance,
-    &::graph::_PingRequest_default_instance_._instance,
-    &::graph::_PingResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-    "\n\013graph.proto\022\005graph\032\033google/protobuf/em"
-    "pty.proto\"$\n\004Host\022\013\n\003key\030\001 \001(\t\022\017\n\007addres"
-    "s\030\002 \001(\t\"$\n\006Vertex\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030"
-    "\002 \001(\t\"d\n\004Edge\022\014\n\004from\030\001 \001(\t\022\n\n\002to\030\002 \001(\t\022"
-    "\r\n\005label\030\003 \001(\t\022\023\n\013lookup_from\030\004 \001(\t\022\021\n\tl"
-    "ookup_to\030\005 \001(\t\022\013\n\003key\030\006 \001(\t\"8\n\014GraphSumm"
-    "ary\022\024\n\014vertex_count\030\001 \001(\005\022\022\n\nedge_count\030"
-    "\002 \001(\005\"\177\n\nSearchArgs\022\021\n\tstart_key\030\001 \001(\t\022\r"
-    "\n\005level\030\002 \001(\005\022\037\n\010vertices\030\003 \003(\0132\r.graph."
-    "Vertex\022\032\n\005edges\030\004 \003(\0132\013.graph.Edge\022\022\n\nid"
-    "s_so_far\030\005 \003(\t\"`\n\rSearchResults\022\037\n\010verti"
-    "ces\030\001 \003(\0132\r.graph.Vertex\022\032\n\005edges\030\002 \003(\0132"
-    "\013.graph.Edge\022\022\n\nids_so_far\030\003 \003(\t\"\033\n\013Ping"
-    "Request\022\014\n\004data\030\001 \001(\t\"\034\n\014PingResponse\022\014\n"
-    "\004data\030\001 \001(\t2\363\002\n\005Graph\0220\n\007AddHost\022\013.graph"
-    ".Host\032\026.google.protobuf.Empty\"\000\0223\n\tAddVe"
-    "rtex\022\r.graph.Vertex\032\023.graph.GraphSummary"
-    "\"\000(\001\0226\n\014DeleteVertex\022\r.graph.Vertex\032\023.gr"
-    "aph.GraphSummary\"\000(\001\022/\n\007AddEdge\022\013.graph."
-    "Edge\032\023.graph.GraphSummary\"\000(\001\0222\n\nDeleteE"
-    "dge\022\013.graph.Edge\032\023.graph.GraphSummary\"\000("
-    "\001\0223\n\006Search\022\021.graph.SearchArgs\032\024.graph.S"
-    "earchResults\"\000\0221\n\004Ping\022\022.graph.PingReque"
-    "st\032\023.graph.PingResponse\"\000b\006proto3"
-};
-static const ::_pbi::DescriptorTable* const descriptor_table_graph_2eproto_deps[1] =
-    {
-        &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
-};
-static ::absl::once_flag descriptor_table_graph_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_graph_2eproto = {
-    false,
-    false,
-    953,
-    descriptor_table_protodef_graph_2eproto,
-    "graph.proto",
-    &descriptor_table_graph_2eproto_once,
-    descriptor_table_graph_2eproto_deps,
-    1,
-    8,
-    schemas,
-    file_default_instances,
-    TableStruct_graph_2eproto::offsets,
-    file_level_metadata_graph_2eproto,
-    file_level_enum_descriptors_graph_2eproto,
-    file_level_service_descriptors_graph_2eproto,
-};
-
-// This function exists to be marked as weak.
-// It can significantly speed up compilation by breaking up LLVM's SCC
-// in the .pb.cc translation units. Large translation units see a
-// reduction of more than 35% of walltime for optimized builds. Without
-// the weak attribute all the messages in the file, including all the
-// vtables and everything they use become part of the same SCC through
-// a cycle like:
-// GetMetadata -> descriptor table -> default instances ->
-//   vtables -> GetMetadata
-// By adding a weak function here we break the connection from the
-// individual vtables back into the descriptor table.
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_graph_2eproto_getter() {
-  return &descriptor_table_graph_2eproto;
-}
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
-static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_graph_2eproto(&descriptor_table_graph_2eproto);
-namespace graph {
-// ===================================================================
-
-class Host::_Internal {
- public:
-};
-
-Host::Host(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.Host)
-}
-Host::Host(const Host& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Host* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.key_) {}
-
-    , decltype(_impl_.address_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), _this->GetArenaForAllocation());
-  }
-  _impl_.address_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.address_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_address().empty()) {
-    _this->_impl_.address_.Set(from._internal_address(), _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:graph.Host)
-}
-
-inline void Host::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.key_) {}
-
-    , decltype(_impl_.address_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.address_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.address_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-Host::~Host() {
-  // @@protoc_insertion_point(destructor:graph.Host)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Host::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.key_.Destroy();
-  _impl_.address_.Destroy();
-}
-
-void Host::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void Host::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.Host)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.key_.ClearToEmpty();
-  _impl_.address_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Host::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string key = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Host.key"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string address = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_address();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Host.address"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* Host::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.Host)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    const std::string& _s = this->_internal_key();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Host.key");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  // string address = 2;
-  if (!this->_internal_address().empty()) {
-    const std::string& _s = this->_internal_address();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Host.address");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.Host)
-  return target;
-}
-
-::size_t Host::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.Host)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_key());
-  }
-
-  // string address = 2;
-  if (!this->_internal_address().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_address());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Host::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Host::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Host::GetClassData() const { return &_class_data_; }
-
-
-void Host::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Host*>(&to_msg);
-  auto& from = static_cast<const Host&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.Host)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  if (!from._internal_address().empty()) {
-    _this->_internal_set_address(from._internal_address());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Host::CopyFrom(const Host& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.Host)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Host::IsInitialized() const {
-  return true;
-}
-
-void Host::InternalSwap(Host* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, lhs_arena,
-                                       &other->_impl_.key_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.address_, lhs_arena,
-                                       &other->_impl_.address_, rhs_arena);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Host::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[0]);
-}
-// ===================================================================
-
-class Vertex::_Internal {
- public:
-};
-
-Vertex::Vertex(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.Vertex)
-}
-Vertex::Vertex(const Vertex& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Vertex* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.key_) {}
-
-    , decltype(_impl_.value_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), _this->GetArenaForAllocation());
-  }
-  _impl_.value_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.value_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_value().empty()) {
-    _this->_impl_.value_.Set(from._internal_value(), _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:graph.Vertex)
-}
-
-inline void Vertex::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.key_) {}
-
-    , decltype(_impl_.value_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.value_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.value_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-Vertex::~Vertex() {
-  // @@protoc_insertion_point(destructor:graph.Vertex)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Vertex::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.key_.Destroy();
-  _impl_.value_.Destroy();
-}
-
-void Vertex::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void Vertex::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.Vertex)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.key_.ClearToEmpty();
-  _impl_.value_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Vertex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string key = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Vertex.key"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string value = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_value();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Vertex.value"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* Vertex::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.Vertex)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    const std::string& _s = this->_internal_key();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Vertex.key");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  // string value = 2;
-  if (!this->_internal_value().empty()) {
-    const std::string& _s = this->_internal_value();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Vertex.value");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.Vertex)
-  return target;
-}
-
-::size_t Vertex::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.Vertex)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_key());
-  }
-
-  // string value = 2;
-  if (!this->_internal_value().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_value());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vertex::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Vertex::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vertex::GetClassData() const { return &_class_data_; }
-
-
-void Vertex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Vertex*>(&to_msg);
-  auto& from = static_cast<const Vertex&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.Vertex)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  if (!from._internal_value().empty()) {
-    _this->_internal_set_value(from._internal_value());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Vertex::CopyFrom(const Vertex& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.Vertex)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Vertex::IsInitialized() const {
-  return true;
-}
-
-void Vertex::InternalSwap(Vertex* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, lhs_arena,
-                                       &other->_impl_.key_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, lhs_arena,
-                                       &other->_impl_.value_, rhs_arena);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Vertex::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[1]);
-}
-// ===================================================================
-
-class Edge::_Internal {
- public:
-};
-
-Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.Edge)
-}
-Edge::Edge(const Edge& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Edge* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.from_) {}
-
-    , decltype(_impl_.to_) {}
-
-    , decltype(_impl_.label_) {}
-
-    , decltype(_impl_.lookup_from_) {}
-
-    , decltype(_impl_.lookup_to_) {}
-
-    , decltype(_impl_.key_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.from_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_from().empty()) {
-    _this->_impl_.from_.Set(from._internal_from(), _this->GetArenaForAllocation());
-  }
-  _impl_.to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.to_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_to().empty()) {
-    _this->_impl_.to_.Set(from._internal_to(), _this->GetArenaForAllocation());
-  }
-  _impl_.label_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.label_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_label().empty()) {
-    _this->_impl_.label_.Set(from._internal_label(), _this->GetArenaForAllocation());
-  }
-  _impl_.lookup_from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.lookup_from_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_lookup_from().empty()) {
-    _this->_impl_.lookup_from_.Set(from._internal_lookup_from(), _this->GetArenaForAllocation());
-  }
-  _impl_.lookup_to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.lookup_to_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_lookup_to().empty()) {
-    _this->_impl_.lookup_to_.Set(from._internal_lookup_to(), _this->GetArenaForAllocation());
-  }
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:graph.Edge)
-}
-
-inline void Edge::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.from_) {}
-
-    , decltype(_impl_.to_) {}
-
-    , decltype(_impl_.label_) {}
-
-    , decltype(_impl_.lookup_from_) {}
-
-    , decltype(_impl_.lookup_to_) {}
-
-    , decltype(_impl_.key_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.from_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.to_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.label_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.label_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.lookup_from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.lookup_from_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.lookup_to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.lookup_to_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-Edge::~Edge() {
-  // @@protoc_insertion_point(destructor:graph.Edge)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Edge::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.from_.Destroy();
-  _impl_.to_.Destroy();
-  _impl_.label_.Destroy();
-  _impl_.lookup_from_.Destroy();
-  _impl_.lookup_to_.Destroy();
-  _impl_.key_.Destroy();
-}
-
-void Edge::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void Edge::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.Edge)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.from_.ClearToEmpty();
-  _impl_.to_.ClearToEmpty();
-  _impl_.label_.ClearToEmpty();
-  _impl_.lookup_from_.ClearToEmpty();
-  _impl_.lookup_to_.ClearToEmpty();
-  _impl_.key_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Edge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string from = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_from();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.from"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string to = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_to();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.to"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string label = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_label();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.label"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string lookup_from = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_lookup_from();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.lookup_from"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string lookup_to = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_lookup_to();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.lookup_to"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // string key = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.Edge.key"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* Edge::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.Edge)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string from = 1;
-  if (!this->_internal_from().empty()) {
-    const std::string& _s = this->_internal_from();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.from");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  // string to = 2;
-  if (!this->_internal_to().empty()) {
-    const std::string& _s = this->_internal_to();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.to");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
-  }
-
-  // string label = 3;
-  if (!this->_internal_label().empty()) {
-    const std::string& _s = this->_internal_label();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.label");
-    target = stream->WriteStringMaybeAliased(3, _s, target);
-  }
-
-  // string lookup_from = 4;
-  if (!this->_internal_lookup_from().empty()) {
-    const std::string& _s = this->_internal_lookup_from();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.lookup_from");
-    target = stream->WriteStringMaybeAliased(4, _s, target);
-  }
-
-  // string lookup_to = 5;
-  if (!this->_internal_lookup_to().empty()) {
-    const std::string& _s = this->_internal_lookup_to();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.lookup_to");
-    target = stream->WriteStringMaybeAliased(5, _s, target);
-  }
-
-  // string key = 6;
-  if (!this->_internal_key().empty()) {
-    const std::string& _s = this->_internal_key();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.Edge.key");
-    target = stream->WriteStringMaybeAliased(6, _s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.Edge)
-  return target;
-}
-
-::size_t Edge::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.Edge)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string from = 1;
-  if (!this->_internal_from().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_from());
-  }
-
-  // string to = 2;
-  if (!this->_internal_to().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_to());
-  }
-
-  // string label = 3;
-  if (!this->_internal_label().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_label());
-  }
-
-  // string lookup_from = 4;
-  if (!this->_internal_lookup_from().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_lookup_from());
-  }
-
-  // string lookup_to = 5;
-  if (!this->_internal_lookup_to().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_lookup_to());
-  }
-
-  // string key = 6;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_key());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Edge::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Edge::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Edge::GetClassData() const { return &_class_data_; }
-
-
-void Edge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Edge*>(&to_msg);
-  auto& from = static_cast<const Edge&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.Edge)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_from().empty()) {
-    _this->_internal_set_from(from._internal_from());
-  }
-  if (!from._internal_to().empty()) {
-    _this->_internal_set_to(from._internal_to());
-  }
-  if (!from._internal_label().empty()) {
-    _this->_internal_set_label(from._internal_label());
-  }
-  if (!from._internal_lookup_from().empty()) {
-    _this->_internal_set_lookup_from(from._internal_lookup_from());
-  }
-  if (!from._internal_lookup_to().empty()) {
-    _this->_internal_set_lookup_to(from._internal_lookup_to());
-  }
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Edge::CopyFrom(const Edge& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.Edge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Edge::IsInitialized() const {
-  return true;
-}
-
-void Edge::InternalSwap(Edge* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.from_, lhs_arena,
-                                       &other->_impl_.from_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.to_, lhs_arena,
-                                       &other->_impl_.to_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.label_, lhs_arena,
-                                       &other->_impl_.label_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.lookup_from_, lhs_arena,
-                                       &other->_impl_.lookup_from_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.lookup_to_, lhs_arena,
-                                       &other->_impl_.lookup_to_, rhs_arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, lhs_arena,
-                                       &other->_impl_.key_, rhs_arena);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Edge::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[2]);
-}
-// ===================================================================
-
-class GraphSummary::_Internal {
- public:
-};
-
-GraphSummary::GraphSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.GraphSummary)
-}
-GraphSummary::GraphSummary(const GraphSummary& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _impl_(from._impl_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(
-      from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph.GraphSummary)
-}
-
-inline void GraphSummary::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.vertex_count_) { 0 }
-
-    , decltype(_impl_.edge_count_) { 0 }
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-}
-
-GraphSummary::~GraphSummary() {
-  // @@protoc_insertion_point(destructor:graph.GraphSummary)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void GraphSummary::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-}
-
-void GraphSummary::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void GraphSummary::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.GraphSummary)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.vertex_count_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.edge_count_) -
-      reinterpret_cast<char*>(&_impl_.vertex_count_)) + sizeof(_impl_.edge_count_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* GraphSummary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // int32 vertex_count = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 8)) {
-          _impl_.vertex_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // int32 edge_count = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 16)) {
-          _impl_.edge_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* GraphSummary::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.GraphSummary)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 vertex_count = 1;
-  if (this->_internal_vertex_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
-        1, this->_internal_vertex_count(), target);
-  }
-
-  // int32 edge_count = 2;
-  if (this->_internal_edge_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
-        2, this->_internal_edge_count(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.GraphSummary)
-  return target;
-}
-
-::size_t GraphSummary::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.GraphSummary)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 vertex_count = 1;
-  if (this->_internal_vertex_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_vertex_count());
-  }
-
-  // int32 edge_count = 2;
-  if (this->_internal_edge_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_edge_count());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GraphSummary::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GraphSummary::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GraphSummary::GetClassData() const { return &_class_data_; }
-
-
-void GraphSummary::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GraphSummary*>(&to_msg);
-  auto& from = static_cast<const GraphSummary&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.GraphSummary)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_vertex_count() != 0) {
-    _this->_internal_set_vertex_count(from._internal_vertex_count());
-  }
-  if (from._internal_edge_count() != 0) {
-    _this->_internal_set_edge_count(from._internal_edge_count());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GraphSummary::CopyFrom(const GraphSummary& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.GraphSummary)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool GraphSummary::IsInitialized() const {
-  return true;
-}
-
-void GraphSummary::InternalSwap(GraphSummary* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GraphSummary, _impl_.edge_count_)
-      + sizeof(GraphSummary::_impl_.edge_count_)
-      - PROTOBUF_FIELD_OFFSET(GraphSummary, _impl_.vertex_count_)>(
-          reinterpret_cast<char*>(&_impl_.vertex_count_),
-          reinterpret_cast<char*>(&other->_impl_.vertex_count_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata GraphSummary::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[3]);
-}
-// ===================================================================
-
-class SearchArgs::_Internal {
- public:
-};
-
-SearchArgs::SearchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.SearchArgs)
-}
-SearchArgs::SearchArgs(const SearchArgs& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SearchArgs* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.vertices_){from._impl_.vertices_}
-    , decltype(_impl_.edges_){from._impl_.edges_}
-    , decltype(_impl_.ids_so_far_){from._impl_.ids_so_far_}
-    , decltype(_impl_.start_key_) {}
-
-    , decltype(_impl_.level_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.start_key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.start_key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_start_key().empty()) {
-    _this->_impl_.start_key_.Set(from._internal_start_key(), _this->GetArenaForAllocation());
-  }
-  _this->_impl_.level_ = from._impl_.level_;
-  // @@protoc_insertion_point(copy_constructor:graph.SearchArgs)
-}
-
-inline void SearchArgs::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.vertices_){arena}
-    , decltype(_impl_.edges_){arena}
-    , decltype(_impl_.ids_so_far_){arena}
-    , decltype(_impl_.start_key_) {}
-
-    , decltype(_impl_.level_) { 0 }
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.start_key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.start_key_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-SearchArgs::~SearchArgs() {
-  // @@protoc_insertion_point(destructor:graph.SearchArgs)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void SearchArgs::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _internal_mutable_vertices()->~RepeatedPtrField();
-  _internal_mutable_edges()->~RepeatedPtrField();
-  _internal_mutable_ids_so_far()->~RepeatedPtrField();
-  _impl_.start_key_.Destroy();
-}
-
-void SearchArgs::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void SearchArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.SearchArgs)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_mutable_vertices()->Clear();
-  _internal_mutable_edges()->Clear();
-  _internal_mutable_ids_so_far()->Clear();
-  _impl_.start_key_.ClearToEmpty();
-  _impl_.level_ = 0;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* SearchArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string start_key = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_start_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.SearchArgs.start_key"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // int32 level = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 16)) {
-          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // repeated .graph.Vertex vertices = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_vertices(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // repeated .graph.Edge edges = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 34)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_edges(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // repeated string ids_so_far = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_ids_so_far();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "graph.SearchArgs.ids_so_far"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* SearchArgs::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.SearchArgs)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string start_key = 1;
-  if (!this->_internal_start_key().empty()) {
-    const std::string& _s = this->_internal_start_key();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.SearchArgs.start_key");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  // int32 level = 2;
-  if (this->_internal_level() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
-        2, this->_internal_level(), target);
-  }
-
-  // repeated .graph.Vertex vertices = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_vertices_size()); i < n; i++) {
-    const auto& repfield = this->_internal_vertices(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  // repeated .graph.Edge edges = 4;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
-    const auto& repfield = this->_internal_edges(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  // repeated string ids_so_far = 5;
-  for (int i = 0, n = this->_internal_ids_so_far_size(); i < n; ++i) {
-    const auto& s = this->_internal_ids_so_far(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        s.data(), static_cast<int>(s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.SearchArgs.ids_so_far");
-    target = stream->WriteString(5, s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.SearchArgs)
-  return target;
-}
-
-::size_t SearchArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.SearchArgs)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated .graph.Vertex vertices = 3;
-  total_size += 1UL * this->_internal_vertices_size();
-  for (const auto& msg : this->_internal_vertices()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .graph.Edge edges = 4;
-  total_size += 1UL * this->_internal_edges_size();
-  for (const auto& msg : this->_internal_edges()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated string ids_so_far = 5;
-  total_size += 1 * ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_internal_ids_so_far().size());
-  for (int i = 0, n = _internal_ids_so_far().size(); i < n; ++i) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        _internal_ids_so_far().Get(i));
-  }
-
-  // string start_key = 1;
-  if (!this->_internal_start_key().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_start_key());
-  }
-
-  // int32 level = 2;
-  if (this->_internal_level() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_level());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchArgs::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SearchArgs::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchArgs::GetClassData() const { return &_class_data_; }
-
-
-void SearchArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SearchArgs*>(&to_msg);
-  auto& from = static_cast<const SearchArgs&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.SearchArgs)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_vertices()->MergeFrom(from._internal_vertices());
-  _this->_internal_mutable_edges()->MergeFrom(from._internal_edges());
-  _this->_internal_mutable_ids_so_far()->MergeFrom(from._internal_ids_so_far());
-  if (!from._internal_start_key().empty()) {
-    _this->_internal_set_start_key(from._internal_start_key());
-  }
-  if (from._internal_level() != 0) {
-    _this->_internal_set_level(from._internal_level());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchArgs::CopyFrom(const SearchArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.SearchArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool SearchArgs::IsInitialized() const {
-  return true;
-}
-
-void SearchArgs::InternalSwap(SearchArgs* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _internal_mutable_vertices()->InternalSwap(other->_internal_mutable_vertices());
-  _internal_mutable_edges()->InternalSwap(other->_internal_mutable_edges());
-  _internal_mutable_ids_so_far()->InternalSwap(
-      other->_internal_mutable_ids_so_far());
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.start_key_, lhs_arena,
-                                       &other->_impl_.start_key_, rhs_arena);
-
-  swap(_impl_.level_, other->_impl_.level_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata SearchArgs::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[4]);
-}
-// ===================================================================
-
-class SearchResults::_Internal {
- public:
-};
-
-SearchResults::SearchResults(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.SearchResults)
-}
-SearchResults::SearchResults(const SearchResults& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SearchResults* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.vertices_){from._impl_.vertices_}
-    , decltype(_impl_.edges_){from._impl_.edges_}
-    , decltype(_impl_.ids_so_far_){from._impl_.ids_so_far_}
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph.SearchResults)
-}
-
-inline void SearchResults::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.vertices_){arena}
-    , decltype(_impl_.edges_){arena}
-    , decltype(_impl_.ids_so_far_){arena}
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-}
-
-SearchResults::~SearchResults() {
-  // @@protoc_insertion_point(destructor:graph.SearchResults)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void SearchResults::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _internal_mutable_vertices()->~RepeatedPtrField();
-  _internal_mutable_edges()->~RepeatedPtrField();
-  _internal_mutable_ids_so_far()->~RepeatedPtrField();
-}
-
-void SearchResults::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void SearchResults::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.SearchResults)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_mutable_vertices()->Clear();
-  _internal_mutable_edges()->Clear();
-  _internal_mutable_ids_so_far()->Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* SearchResults::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // repeated .graph.Vertex vertices = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_vertices(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // repeated .graph.Edge edges = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_edges(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      // repeated string ids_so_far = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_ids_so_far();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "graph.SearchResults.ids_so_far"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* SearchResults::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.SearchResults)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .graph.Vertex vertices = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_vertices_size()); i < n; i++) {
-    const auto& repfield = this->_internal_vertices(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  // repeated .graph.Edge edges = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
-    const auto& repfield = this->_internal_edges(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  // repeated string ids_so_far = 3;
-  for (int i = 0, n = this->_internal_ids_so_far_size(); i < n; ++i) {
-    const auto& s = this->_internal_ids_so_far(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        s.data(), static_cast<int>(s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.SearchResults.ids_so_far");
-    target = stream->WriteString(3, s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.SearchResults)
-  return target;
-}
-
-::size_t SearchResults::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.SearchResults)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated .graph.Vertex vertices = 1;
-  total_size += 1UL * this->_internal_vertices_size();
-  for (const auto& msg : this->_internal_vertices()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .graph.Edge edges = 2;
-  total_size += 1UL * this->_internal_edges_size();
-  for (const auto& msg : this->_internal_edges()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated string ids_so_far = 3;
-  total_size += 1 * ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_internal_ids_so_far().size());
-  for (int i = 0, n = _internal_ids_so_far().size(); i < n; ++i) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        _internal_ids_so_far().Get(i));
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchResults::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SearchResults::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchResults::GetClassData() const { return &_class_data_; }
-
-
-void SearchResults::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SearchResults*>(&to_msg);
-  auto& from = static_cast<const SearchResults&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.SearchResults)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_vertices()->MergeFrom(from._internal_vertices());
-  _this->_internal_mutable_edges()->MergeFrom(from._internal_edges());
-  _this->_internal_mutable_ids_so_far()->MergeFrom(from._internal_ids_so_far());
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchResults::CopyFrom(const SearchResults& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.SearchResults)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool SearchResults::IsInitialized() const {
-  return true;
-}
-
-void SearchResults::InternalSwap(SearchResults* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _internal_mutable_vertices()->InternalSwap(other->_internal_mutable_vertices());
-  _internal_mutable_edges()->InternalSwap(other->_internal_mutable_edges());
-  _internal_mutable_ids_so_far()->InternalSwap(
-      other->_internal_mutable_ids_so_far());
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata SearchResults::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[5]);
-}
-// ===================================================================
-
-class PingRequest::_Internal {
- public:
-};
-
-PingRequest::PingRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.PingRequest)
-}
-PingRequest::PingRequest(const PingRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  PingRequest* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.data_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.data_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_data().empty()) {
-    _this->_impl_.data_.Set(from._internal_data(), _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:graph.PingRequest)
-}
-
-inline void PingRequest::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.data_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.data_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-PingRequest::~PingRequest() {
-  // @@protoc_insertion_point(destructor:graph.PingRequest)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void PingRequest::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.data_.Destroy();
-}
-
-void PingRequest::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void PingRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.PingRequest)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.data_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* PingRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string data = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_data();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.PingRequest.data"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* PingRequest::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.PingRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    const std::string& _s = this->_internal_data();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.PingRequest.data");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.PingRequest)
-  return target;
-}
-
-::size_t PingRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.PingRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_data());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PingRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    PingRequest::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PingRequest::GetClassData() const { return &_class_data_; }
-
-
-void PingRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<PingRequest*>(&to_msg);
-  auto& from = static_cast<const PingRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.PingRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_data().empty()) {
-    _this->_internal_set_data(from._internal_data());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PingRequest::CopyFrom(const PingRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.PingRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PingRequest::IsInitialized() const {
-  return true;
-}
-
-void PingRequest::InternalSwap(PingRequest* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.data_, lhs_arena,
-                                       &other->_impl_.data_, rhs_arena);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata PingRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[6]);
-}
-// ===================================================================
-
-class PingResponse::_Internal {
- public:
-};
-
-PingResponse::PingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph.PingResponse)
-}
-PingResponse::PingResponse(const PingResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  PingResponse* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.data_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.data_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_data().empty()) {
-    _this->_impl_.data_.Set(from._internal_data(), _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:graph.PingResponse)
-}
-
-inline void PingResponse::SharedCtor(::_pb::Arena* arena) {
-  (void)arena;
-  new (&_impl_) Impl_{
-      decltype(_impl_.data_) {}
-
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        _impl_.data_.Set("", GetArenaForAllocation());
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-PingResponse::~PingResponse() {
-  // @@protoc_insertion_point(destructor:graph.PingResponse)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void PingResponse::SharedDtor() {
-  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.data_.Destroy();
-}
-
-void PingResponse::SetCachedSize(int size) const {
-  _impl_._cached_size_.Set(size);
-}
-
-void PingResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph.PingResponse)
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.data_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* PingResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string data = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_data();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "graph.PingResponse.data"));
-        } else {
-          goto handle_unusual;
-        }
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-::uint8_t* PingResponse::_InternalSerialize(
-    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph.PingResponse)
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    const std::string& _s = this->_internal_data();
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "graph.PingResponse.data");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph.PingResponse)
-  return target;
-}
-
-::size_t PingResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph.PingResponse)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-                                    this->_internal_data());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PingResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    PingResponse::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PingResponse::GetClassData() const { return &_class_data_; }
-
-
-void PingResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<PingResponse*>(&to_msg);
-  auto& from = static_cast<const PingResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:graph.PingResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_data().empty()) {
-    _this->_internal_set_data(from._internal_data());
-  }
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PingResponse::CopyFrom(const PingResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph.PingResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PingResponse::IsInitialized() const {
-  return true;
-}
-
-void PingResponse::InternalSwap(PingResponse* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.data_, lhs_arena,
-                                       &other->_impl_.data_, rhs_arena);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata PingResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
-      file_level_metadata_graph_2eproto[7]);
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace graph
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::graph::Host*
-Arena::CreateMaybeMessage< ::graph::Host >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::Host >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::Vertex*
-Arena::CreateMaybeMessage< ::graph::Vertex >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::Vertex >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::Edge*
-Arena::CreateMaybeMessage< ::graph::Edge >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::Edge >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::GraphSummary*
-Arena::CreateMaybeMessage< ::graph::GraphSummary >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::GraphSummary >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::SearchArgs*
-Arena::CreateMaybeMessage< ::graph::SearchArgs >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::SearchArgs >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::SearchResults*
-Arena::CreateMaybeMessage< ::graph::SearchResults >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::SearchResults >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::PingRequest*
-Arena::CreateMaybeMessage< ::graph::PingRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::PingRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph::PingResponse*
-Arena::CreateMaybeMessage< ::graph::PingResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph::PingResponse >(arena);
-}
-PROTOBUF_NAMESPACE_CLOSE
-// @@protoc_insertion_point(global_scope)
-#include "google/protobuf/port_undef.inc"
@@ -42,6 +42,24 @@ KafkaBuilder& KafkaBuilder::WithKafkaMessageStrategy(std::unique_ptr<KafkaMessag
     return *this;
 }
 
+KafkaBuilder& KafkaBuilder::WithBatchSize(size_t v) {
+    m_batch_size = v;
+    return *this;
+}
+
+// Pause consumption once the strategy's backlog reaches `high`, resume at `low`. A `high` of 0 disables backpressure.
+KafkaBuilder& KafkaBuilder::WithWatermarks(size_t high, size_t low) {
+    m_high_watermark = high;
+    m_low_watermark = low;
+    return *this;
+}
+
+// How often applied offsets are committed. Bounds how much gets replayed after a crash.
+KafkaBuilder& KafkaBuilder::WithCommitInterval(size_t ms) {
+    m_commit_interval_ms = ms;
+    return *this;
+}
+
 std::unique_ptr<KafkaDataSource> KafkaBuilder::Build() {
     if (m_name.empty()) {
         m_name = "Kafka";
@@ -71,6 +89,14 @@ std::unique_ptr<KafkaDataSource> KafkaBuilder::Build() {
         throw std::runtime_error("No Kafka strategy provided");
     }
 
+    if (m_batch_size == 0) {
+        throw std::runtime_error("Batch size must be at least 1");
+    }
+
+    if (m_high_watermark > 0 && m_low_watermark >= m_high_watermark) {
+        throw std::runtime_error("Low watermark must be below the high watermark");
+    }
+
     std::unique_ptr<KafkaDataSource> kafka = std::make_unique<KafkaDataSource>();
     kafka->m_name = std::move(m_name);
     kafka->m_bootstrap_servers = std::move(m_bootstrap_servers);
@@ -79,6 +105,13 @@ std::unique_ptr<KafkaDataSource> KafkaBuilder::Build() {
     kafka->m_delivery_report_callback = std::move(m_delivery_report_callback);
     kafka->m_topics = std::move(m_topics);
     kafka->m_kafka_strategy = std::move(m_kafka_strategy);
+    kafka->m_batch_size = m_batch_size;
+    kafka->m_high_watermark = m_high_watermark;
+    kafka->m_low_watermark = m_low_watermark;
+    kafka->m_commit_interval = std::chrono::milliseconds(m_commit_interval_ms);
+    kafka->m_offset_tracker = std::make_shared<OffsetTracker>();
+    kafka->m_kafka_strategy->TrackOffsets(kafka->m_offset_tracker);
+    kafka->m_rebalance_callback = std::make_unique<KafkaRebalanceCb>(kafka.get());
 
     RdKafka::Conf* conf = RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL);
     std::string errstr;
@@ -95,6 +128,18 @@ std::unique_ptr<KafkaDataSource> KafkaBuilder::Build() {
         kill(getpid(), SIGINT);
     }
 
+    /*
+    Offsets are committed by the data source once the messages have been applied, not when they were merely fetched.
+    */
+    if (conf->set("enable.auto.commit", "false", errstr) != RdKafka::Conf::CONF_OK) {
+        std::cout << errstr;
+        kill(getpid(), SIGINT);
+    }
+    if (conf->set("rebalance_cb", kafka->m_rebalance_callback.get(), errstr) != RdKafka::Conf::CONF_OK) {
+        std::cout << errstr;
+        kill(getpid(), SIGINT);
+    }
+
     /* Set the delivery report callback.
      * This callback will be called once per message to inform
      * the application if delivery succeeded or failed.
@@ -19,6 +19,10 @@ class KafkaBuilder {
     std::unique_ptr<KafkaDeliveryReportCb> m_delivery_report_callback;
     std::vector<std::string> m_topics;
     std::unique_ptr<KafkaMessageStrategy> m_kafka_strategy;
+    size_t m_batch_size = 1;
+    size_t m_high_watermark = 0;
+    size_t m_low_watermark = 0;
+    size_t m_commit_interval_ms = 1000;
 
    public:
     KafkaBuilder();
@@ -29,6 +33,9 @@ class KafkaBuilder {
     KafkaBuilder& WithDeliveryReportCallback(std::unique_ptr<KafkaDeliveryReportCb> v);
     KafkaBuilder& WithTopics(std::vector<std::string> v);
     KafkaBuilder& WithKafkaMessageStrategy(std::unique_ptr<KafkaMessageStrategy> v);
+    KafkaBuilder& WithBatchSize(size_t v);
+    KafkaBuilder& WithWatermarks(size_t high, size_t low);
+    KafkaBuilder& WithCommitInterval(size_t ms);
     std::unique_ptr<KafkaDataSource> Build();
 };
 
@@ -6,19 +6,118 @@
 
 #include <iostream>
 
+#include "../logging/logging.h"
 #include "kafka_delivery_report_cb.h"
 #include "kafka_message_strategy.h"
 #include "kafka_print_message_strategy.h"
 
-void KafkaDataSource::Query() {
-    RdKafka::Message *message = m_kafka_consumer->consume(0);
-    m_kafka_strategy->Run(message, NULL);
-    delete message;
+bool KafkaDataSource::Query() {
+    // Messages a full shard didn't take go first. Until they are through, consumption stays paused.
+    m_kafka_strategy->Flush();
+    ApplyBackpressure();
+
+    /*
+    Drain up to a batch per poll instead of a single message so one consumer can keep several apply shards busy.
+
+    We keep calling consume() while paused. It returns nothing for paused partitions but keeps us in the consumer
+    group and serves rebalances.
+    */
+    bool more = true;
+    for (size_t i = 0; i < m_batch_size && more; ++i) {
+        std::unique_ptr<RdKafka::Message> message(m_kafka_consumer->consume(0));
+        more = message->err() != RdKafka::ERR__TIMED_OUT;
+        m_kafka_strategy->Run(std::move(message), NULL);
+    }
+
+    if (std::chrono::steady_clock::now() - m_last_commit >= m_commit_interval) {
+        CommitOffsets(false);
+    }
+
+    /*
+    A full batch means there is likely more waiting. Paused, we only get timeouts and back off. So we do while a full
+    shard holds messages back, the dispatcher's backoff paces the retries.
+    */
+    return more && m_kafka_strategy->Pending() == 0;
+}
+
+/*
+Auto commit is off. We commit, per partition, up to the last message the apply shards acked (see OffsetTracker), so a
+restart replays at most what was in flight plus one commit interval.
+
+Commits are batched: one (async) commit per interval covering all partitions that moved. A failed async commit is
+not retried on its own, the next commit of that partition supersedes it.
+*/
+void KafkaDataSource::CommitOffsets(bool sync) {
+    m_last_commit = std::chrono::steady_clock::now();
+    std::vector<OffsetTracker::Position> positions = m_offset_tracker->Committable();
+    if (positions.empty()) {
+        return;
+    }
+
+    std::vector<RdKafka::TopicPartition *> offsets;
+    offsets.reserve(positions.size());
+    for (const auto &position : positions) {
+        offsets.push_back(RdKafka::TopicPartition::create(position.topic, position.partition, position.offset));
+    }
+
+    RdKafka::ErrorCode err = sync ? m_kafka_consumer->commitSync(offsets) : m_kafka_consumer->commitAsync(offsets);
+    RdKafka::TopicPartition::destroy(offsets);
+
+    if (err) {
+        Logging::ERROR("Failed to commit offsets: " + RdKafka::err2str(err), m_name);
+    } else {
+        LOG_DEBUG(m_name, "Committed offsets of {} partitions", positions.size());
+    }
+}
+
+/*
+Hysteresis between the two watermarks: stop fetching once the apply shards fall `high` messages behind and only start
+again once they caught up to `low`. The backlog stays in Kafka instead of our heap.
+
+Messages held back by the strategy pause consumption regardless of the watermarks, until they got through.
+*/
+void KafkaDataSource::ApplyBackpressure() {
+    bool stalled = m_kafka_strategy->Pending() > 0;
+    if (m_high_watermark == 0 && !stalled && !m_paused) {
+        return;
+    }
+
+    size_t backlog = m_kafka_strategy->Backlog();
+    bool high = stalled || (m_high_watermark > 0 && backlog >= m_high_watermark);
+    bool low = !stalled && (m_high_watermark == 0 || backlog <= m_low_watermark);
+    if (!m_paused && high) {
+        Logging::WARN("Backlog of " + std::to_string(backlog) + " messages, pausing consumption", m_name);
+        SetPaused(true);
+    } else if (m_paused && low) {
+        Logging::INFO("Backlog down to " + std::to_string(backlog) + " messages, resuming consumption", m_name);
+        SetPaused(false);
+    }
+}
+
+void KafkaDataSource::SetPaused(bool paused) {
+    std::vector<RdKafka::TopicPartition *> partitions;
+    RdKafka::ErrorCode err = m_kafka_consumer->assignment(partitions);
+    if (!err) {
+        err = paused ? m_kafka_consumer->pause(partitions) : m_kafka_consumer->resume(partitions);
+    }
+    RdKafka::TopicPartition::destroy(partitions);
+
+    if (err) {
+        Logging::ERROR(std::string("Failed to ") + (paused ? "pause" : "resume") + " partitions: " +
+                           RdKafka::err2str(err),
+                       m_name);
+        return;
+    }
+    m_paused = paused;
 }
 
 void KafkaDataSource::Stop() {
     std::cout << m_name << " stopping" << std::endl;
 
+    // Last chance to commit what got applied. Whatever is still in flight is consumed again on restart.
+    CommitOffsets(true);
+    Logging::INFO(std::to_string(m_offset_tracker->InFlight()) + " messages in flight will be replayed", m_name);
+
     m_kafka_consumer->close();
     delete m_kafka_consumer;
 
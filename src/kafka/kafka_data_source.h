@@ -3,14 +3,17 @@
 
 #include <rdkafkacpp.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "../data_source.h"
+#include "../offset_tracker.h"
 #include "kafka_delivery_report_cb.h"
 #include "kafka_message_strategy.h"
+#include "kafka_rebalance_cb.h"
 
 class KafkaBuilder;
 
@@ -21,18 +24,31 @@ class KafkaDataSource : public DataSource {
     std::string m_client_id;
     std::string m_group_id;
     std::unique_ptr<KafkaDeliveryReportCb> m_delivery_report_callback;
+    std::unique_ptr<KafkaRebalanceCb> m_rebalance_callback;
     std::vector<std::string> m_topics;
     RdKafka::KafkaConsumer* m_kafka_consumer;
     std::unique_ptr<KafkaMessageStrategy> m_kafka_strategy;
+    size_t m_batch_size = 1;
+    size_t m_high_watermark = 0;
+    size_t m_low_watermark = 0;
+    bool m_paused = false;
+    std::shared_ptr<OffsetTracker> m_offset_tracker;
+    std::chrono::milliseconds m_commit_interval{1000};
+    std::chrono::steady_clock::time_point m_last_commit;
+
+    void ApplyBackpressure();
+    void SetPaused(bool paused);
+    void CommitOffsets(bool sync);
 
    protected:
-    void Query() override;
+    bool Query() override;
 
    public:
     ~KafkaDataSource();
     void Stop() override;
 
     friend class KafkaBuilder;
+    friend class KafkaRebalanceCb;
 };
 
 #endif
\ No newline at end of file
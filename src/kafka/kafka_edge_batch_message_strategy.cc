@@ -0,0 +1,6 @@
+#include "kafka_edge_batch_message_strategy.h"
+
+REGISTER_DEF_TYPE(KafkaEdgeBatchMessageStrategy, EdgeBatchType);
+
+// Defined out of line so the vtable, and with it the registration above, lives in this object file. See main.cc.
+KafkaEdgeBatchMessageStrategy::~KafkaEdgeBatchMessageStrategy() {}
@@ -0,0 +1,23 @@
+#ifndef KAFKA_EDGE_BATCH_MESSAGE_STRATEGY_H
+#define KAFKA_EDGE_BATCH_MESSAGE_STRATEGY_H
+#include "kafka_print_message_strategy.h"
+
+/**
+ * Consumes messages carrying a serialized graph::EdgeBatch instead of one JSON edge per message. Routing, ownership
+ * handover and error handling are the same as for JSON; only the payload is tagged so the shards decode it as a batch.
+ *
+ * Batches are usually produced without a key and hence stay on the shard of their partition.
+ **/
+class KafkaEdgeBatchMessageStrategy : public KafkaPrintMessageStrategy {
+   private:
+    REGISTER_DEC_TYPE(KafkaEdgeBatchMessageStrategy);
+
+   protected:
+    PayloadFormat Format() const override { return PayloadFormat::EDGE_BATCH; }
+
+   public:
+    using KafkaPrintMessageStrategy::KafkaPrintMessageStrategy;
+    ~KafkaEdgeBatchMessageStrategy();
+};
+
+#endif
@@ -3,15 +3,28 @@
 #include <rdkafkacpp.h>
 
 #include <memory>
+#include <string>
+
+#include "../offset_tracker.h"
 
 class KafkaMessageStrategy {
    public:
     KafkaMessageStrategy(std::string name);
-    virtual void Run(RdKafka::Message *message, void *opaque) const = 0;
+    // Takes ownership of the message so strategies can hand its buffer on instead of copying it.
+    virtual void Run(std::unique_ptr<RdKafka::Message> message, void *opaque) const = 0;
+    // Number of messages handed on but not processed yet. The data source pauses consumption when this grows too big.
+    virtual size_t Backlog() const { return 0; }
+    // Number of messages Run() had to hold back, e.g. because their shard was full. Nothing is lost, Flush() retries.
+    virtual size_t Pending() const { return 0; }
+    // Hands on the held back messages, in order. Returns whether none are left.
+    virtual bool Flush() const { return true; }
+    // Offsets of handed on messages get registered here. Whoever processes them reports back once done.
+    void TrackOffsets(std::shared_ptr<OffsetTracker> tracker) { m_offset_tracker = std::move(tracker); }
     virtual ~KafkaMessageStrategy() = default;
 
    protected:
     std::string m_name;
+    std::shared_ptr<OffsetTracker> m_offset_tracker;
 };
 
 #endif
\ No newline at end of file
@@ -15,30 +15,64 @@ not pull that object into the application and REGISTER_DEF_TYPE() will never be
 */
 REGISTER_DEF_TYPE(KafkaPrintMessageStrategy, PrintType);
 
-void KafkaPrintMessageStrategy::Run(RdKafka::Message *message, void *opaque) const {
+void KafkaPrintMessageStrategy::Run(std::unique_ptr<RdKafka::Message> message, void *opaque) const {
+    size_t shard = 0;
+    const char *data = nullptr;
+    int64_t offset = 0;
+    Payload payload;
     switch (message->err()) {
         case RdKafka::ERR__TIMED_OUT:
             break;
 
         case RdKafka::ERR_NO_ERROR:
             /* Real message */
-            Logging::DEBUG("Read msg at offset " + std::to_string(message->offset()), m_name);
-            RdKafka::MessageTimestamp ts;
-            ts = message->timestamp();
-            if (ts.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
-                std::string tsname = "?";
-                if (ts.type == RdKafka::MessageTimestamp::MSG_TIMESTAMP_CREATE_TIME)
-                    tsname = "create time";
-                else if (ts.type == RdKafka::MessageTimestamp::MSG_TIMESTAMP_LOG_APPEND_TIME)
-                    tsname = "log append time";
-                Logging::DEBUG("Timestamp: " + tsname + " " + std::to_string(ts.timestamp), m_name);
+            LOG_DEBUG(m_name, "Read msg at offset {}", message->offset());
+            if (Logging::enabled(Logging::Level::DEBUG)) {
+                RdKafka::MessageTimestamp ts = message->timestamp();
+                if (ts.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
+                    const char *tsname = "?";
+                    if (ts.type == RdKafka::MessageTimestamp::MSG_TIMESTAMP_CREATE_TIME)
+                        tsname = "create time";
+                    else if (ts.type == RdKafka::MessageTimestamp::MSG_TIMESTAMP_LOG_APPEND_TIME)
+                        tsname = "log append time";
+                    LOG_DEBUG(m_name, "Timestamp: {} {}", tsname, ts.timestamp);
+                }
             }
             if (message->key()) {
-                Logging::DEBUG("Key: " + *message->key(), m_name);
+                LOG_DEBUG(m_name, "Key: {}", *message->key());
             }
 
-            Logging::DEBUG("Payload: " + std::string(static_cast<const char *>(message->payload())), m_name);
-            m_output_queue->Push(std::string(static_cast<const char *>(message->payload())));
+            // The payload is not NUL-terminated, always go by len()
+            data = static_cast<const char *>(message->payload());
+            LOG_DEBUG(m_name, "Payload: {}", std::string_view(data, message->len()));
+
+            /*
+            Producers key messages by source vertex, so the key picks the apply shard and all edges of a vertex are
+            applied in order by the same shard. Unkeyed messages stay with their partition, which keeps Kafka's own
+            ordering guarantee.
+            */
+            if (message->key()) {
+                shard = m_output_queue->ShardFor(*message->key());
+            } else {
+                shard = message->partition() % m_output_queue->Shards();
+            }
+            // Hand the message itself over; its buffer is freed once the shard has applied the payload.
+            payload = Payload::Own(message.get(), data, message->len());
+            payload.SetFormat(Format());
+            if (m_offset_tracker) {
+                payload.TrackWith(m_offset_tracker, message->topic_name(), message->partition(), message->offset());
+            }
+            offset = message->offset();
+            message.release();
+            if (!m_pending.empty() || !m_output_queue->Push(shard, std::move(payload))) {
+                /*
+                The watermarks should pause us long before a shard fills up, so its consumer is behind. Hold on to the
+                payload, the data source pauses consumption and we retry on every poll (see Flush()).
+                */
+                LOG_EVERY_MS(Logging::Level::WARN, 1000, m_name, "Shard {} is full, holding back message at offset {}",
+                             shard, offset);
+                m_pending.emplace_back(shard, std::move(payload));
+            }
 
             break;
 
@@ -55,4 +89,19 @@ void KafkaPrintMessageStrategy::Run(RdKafka::Message *message, void *opaque) con
             /* Errors */
             Logging::ERROR("Consume failed: " + message->errstr(), m_name);
     }
-}
\ No newline at end of file
+}
+
+size_t KafkaPrintMessageStrategy::Backlog() const {
+    return (m_output_queue ? m_output_queue->Size() : 0) + m_pending.size();
+}
+
+bool KafkaPrintMessageStrategy::Flush() const {
+    while (!m_pending.empty()) {
+        auto &[shard, payload] = m_pending.front();
+        if (!m_output_queue->Push(shard, std::move(payload))) {
+            return false;
+        }
+        m_pending.pop_front();
+    }
+    return true;
+}
@@ -2,9 +2,12 @@
 #define KAFKA_PRINT_MESSAGE_STRATEGY_H
 #include <rdkafkacpp.h>
 
+#include <deque>
 #include <string>
+#include <utility>
 
-#include "../lock_free_queue.h"
+#include "../payload.h"
+#include "../sharded_queue.h"
 #include "kafka_message_strategy.h"
 #include "kafka_strategy_factory.h"
 
@@ -14,11 +17,23 @@ class KafkaPrintMessageStrategy : public KafkaMessageStrategy {
                                                    // StrategyRegister<KafkaPrintMessageStrategy>
 
    public:
-    std::shared_ptr<LockFreeQueue<std::string>> m_output_queue;
+    // Owned by this consumer alone, its poller thread is the only producer
+    std::shared_ptr<ShardedQueue<Payload, SpscQueue>> m_output_queue;
+
+   protected:
+    // Encoding of the messages this strategy consumes. Tells the ingest shards how to decode them.
+    virtual PayloadFormat Format() const { return PayloadFormat::JSON_EDGE; }
 
    public:
     using KafkaMessageStrategy::KafkaMessageStrategy;
-    void Run(RdKafka::Message *message, void *opaque) const override;
+    void Run(std::unique_ptr<RdKafka::Message> message, void *opaque) const override;
+    size_t Backlog() const override;
+    size_t Pending() const override { return m_pending.size(); }
+    bool Flush() const override;
+
+   private:
+    // Payloads a full shard didn't take, with their shard. Once one is held back, later ones queue up behind it.
+    mutable std::deque<std::pair<size_t, Payload>> m_pending;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "kafka_rebalance_cb.h"
+
+#include <string>
+
+#include "../logging/logging.h"
+#include "kafka_data_source.h"
+
+KafkaRebalanceCb::KafkaRebalanceCb(KafkaDataSource *source) : m_source(source) {}
+
+/*
+Called from within consume(), i.e. on the data source's own thread.
+*/
+void KafkaRebalanceCb::rebalance_cb(RdKafka::KafkaConsumer *consumer, RdKafka::ErrorCode err,
+                                    std::vector<RdKafka::TopicPartition *> &partitions) {
+    switch (err) {
+        case RdKafka::ERR__ASSIGN_PARTITIONS:
+            Logging::INFO("Assigned " + std::to_string(partitions.size()) + " partitions", m_source->m_name);
+            consumer->assign(partitions);
+            if (m_source->m_paused) {
+                // Still backed up, don't start fetching the new partitions either
+                consumer->pause(partitions);
+            }
+            break;
+
+        case RdKafka::ERR__REVOKE_PARTITIONS:
+            /*
+            Commit what has been applied so far, the new owner continues from there. Messages of these partitions
+            that are still in flight are applied anyway but their acks are dropped, the new owner consumes them again.
+            */
+            Logging::INFO("Revoked " + std::to_string(partitions.size()) + " partitions", m_source->m_name);
+            m_source->CommitOffsets(true);
+            for (const auto *partition : partitions) {
+                m_source->m_offset_tracker->Forget(partition->topic(), partition->partition());
+            }
+            consumer->unassign();
+            break;
+
+        default:
+            Logging::ERROR("Rebalance failed: " + RdKafka::err2str(err), m_source->m_name);
+            consumer->unassign();
+    }
+}
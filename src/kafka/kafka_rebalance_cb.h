@@ -0,0 +1,26 @@
+
+/**
+ * Kafka rebalance callback. Commits what has been applied before partitions are taken away and keeps newly assigned
+ * partitions in line with the data source's backpressure state.
+ *
+ **/
+#ifndef KAFKA_REBALANCE_CB_H
+#define KAFKA_REBALANCE_CB_H
+
+#include <rdkafkacpp.h>
+
+#include <vector>
+
+class KafkaDataSource;
+
+class KafkaRebalanceCb : public RdKafka::RebalanceCb {
+   public:
+    explicit KafkaRebalanceCb(KafkaDataSource *source);
+    void rebalance_cb(RdKafka::KafkaConsumer *consumer, RdKafka::ErrorCode err,
+                      std::vector<RdKafka::TopicPartition *> &partitions);
+
+   private:
+    KafkaDataSource *m_source;
+};
+
+#endif
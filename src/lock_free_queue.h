@@ -2,46 +2,162 @@
 #define LOCK_FREE_QUEUE_H
 
 #include <atomic>
-#include <iostream>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
+/**
+ * Bounded multi-producer multi-consumer queue (Dmitry Vyukov's ring buffer).
+ *
+ * Every cell carries a sequence number that tells producers and consumers whose turn it is:
+ *  - sequence == pos       the cell is free for the producer that claims position `pos`
+ *  - sequence == pos + 1   the cell holds the element of position `pos`, ready for the consumer that claims it
+ * Claiming a position is a single CAS on the enqueue/dequeue counter, after that the cell is owned exclusively. No
+ * allocation per element, no ABA, nothing to reclaim.
+ *
+ * The two counters live on separate cache lines so producers and consumers don't invalidate each other's line.
+ *
+ * Elements are moved in and out. TryPush only moves from its argument if it succeeds, so a failed push leaves the
+ * caller's element intact.
+ **/
 template <typename T>
 class LockFreeQueue {
    private:
-    struct node {
-        std::shared_ptr<T> data;
-        std::atomic<node*> next;
-        node(T const& data_) : data(std::make_shared<T>(data_)) {}
+    static constexpr size_t kCacheLine = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *Element() { return std::launder(reinterpret_cast<T *>(storage)); }
     };
-    std::atomic<node*> head;
-    std::atomic<node*> tail;
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask;
+    alignas(kCacheLine) std::atomic<size_t> m_enqueue_pos{0};
+    alignas(kCacheLine) std::atomic<size_t> m_dequeue_pos{0};
+    // Keeps whatever follows the queue off the dequeue counter's line
+    char m_padding[kCacheLine - sizeof(std::atomic<size_t>)];
 
    public:
-    void Push(T const& data) {
-        /*
-        head -> ...->...-> tail
-        */
-        std::atomic<node*> const new_node = new node(data);
-        node* old_tail = tail.load();
-        while (old_tail && old_tail->next && !std::atomic_compare_exchange_weak(&old_tail->next, nullptr, new_node)) {
-            node* old_tail = tail.load();
-        }
-        tail.compare_exchange_weak(old_tail, new_node);
-
-        /*
-        The first parameter of atomic<T>::compare_exhange_strong is a T&. It requires an lvalue. That's one half of the
-        "exchange": the current value of the atomic is loaded into the object referred to by the first parameter.
-        */
-        node* tmp = nullptr;
-        head.compare_exchange_weak(tmp, new_node);
+    // `capacity` is rounded up to the next power of two.
+    explicit LockFreeQueue(size_t capacity) {
+        if (capacity < 2) {
+            capacity = 2;
+        }
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+
+        m_cells.reset(new Cell[size]);
+        m_mask = size - 1;
+        for (size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~LockFreeQueue() {
+        // No one else is around anymore, destroy whatever is left
+        size_t end = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (size_t pos = m_dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos) {
+            m_cells[pos & m_mask].Element()->~T();
+        }
+    }
+
+    LockFreeQueue(const LockFreeQueue &) = delete;
+    LockFreeQueue &operator=(const LockFreeQueue &) = delete;
+
+    // Returns false if the queue is full. `t` is only moved from on success.
+    bool TryPush(T &&t) {
+        Cell *cell;
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The consumer of the previous round hasn't freed this cell yet
+                return false;
+            } else {
+                // Another producer claimed pos, try the next one
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (cell->storage) T(std::move(t));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
     }
-    std::shared_ptr<T> Pop() {
-        node* old_head = head.load();
-        while (old_head && !head.compare_exchange_weak(old_head, old_head->next)) {
-            old_head = head.load();
+
+    // Returns false if the queue is empty.
+    bool TryPop(T &t) {
+        Cell *cell;
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The producer of pos hasn't published yet
+                return false;
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T *element = cell->Element();
+        t = std::move(*element);
+        element->~T();
+        // Free the cell for the producer one lap ahead
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*
+    Moves elements from [first, last) into the queue in order until it is full. Returns how many were pushed, those
+    are the first n of the range.
+    */
+    template <typename It>
+    size_t TryPushBatch(It first, It last) {
+        size_t pushed = 0;
+        for (; first != last && TryPush(std::move(*first)); ++first) {
+            ++pushed;
         }
-        return old_head ? old_head->data : std::shared_ptr<T>();
+        return pushed;
     }
+
+    // Pops up to `max` elements into `out` (e.g. a std::back_inserter). Returns how many were popped.
+    template <typename OutputIt>
+    size_t TryPopBatch(OutputIt out, size_t max) {
+        size_t popped = 0;
+        T t;
+        while (popped < max && TryPop(t)) {
+            *out++ = std::move(t);
+            ++popped;
+        }
+        return popped;
+    }
+
+    // Approximate while producers or consumers are active.
+    size_t Size() const {
+        size_t dequeue = m_dequeue_pos.load(std::memory_order_relaxed);
+        size_t enqueue = m_enqueue_pos.load(std::memory_order_relaxed);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    size_t Capacity() const { return m_mask + 1; }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,401 @@
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>  // __rdtsc()
+#endif
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../spsc_queue.h"
+
+namespace Logging {
+
+enum class Level : uint8_t { TRACE = 0, DEBUG = 1, INFO = 2, WARN = 3, ERROR = 4 };
+
+/**
+ * Clock for log records. Reading it has to be cheap, so it is the CPU's timestamp counter where there is one (x86) and
+ * the steady clock elsewhere. The LogProcessor turns readings into wall clock time, see ToSystem().
+ **/
+class LogClock {
+   public:
+    static int64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return static_cast<int64_t>(__rdtsc());
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    static LogClock &Instance() {
+        static LogClock clock;
+        return clock;
+    }
+
+    /*
+    Re-measures the tick rate against the system clock, and re-anchors to it once a second so the mapping follows
+    adjustments of the system clock. Not thread safe, LogProcessor only (once per batch).
+    */
+    void Calibrate() {
+        int64_t ticks = Now();
+        std::chrono::system_clock::time_point wall = std::chrono::system_clock::now();
+        std::chrono::nanoseconds elapsed = wall - m_base_wall;
+        if (ticks <= m_base_ticks || elapsed < std::chrono::milliseconds(1)) {
+            return;
+        }
+
+        m_ns_per_tick = static_cast<double>(elapsed.count()) / static_cast<double>(ticks - m_base_ticks);
+        if (elapsed >= std::chrono::seconds(1)) {
+            m_base_ticks = ticks;
+            m_base_wall = wall;
+        }
+    }
+
+    std::chrono::system_clock::time_point ToSystem(int64_t ticks) const {
+        double offset = static_cast<double>(ticks - m_base_ticks) * m_ns_per_tick;
+        auto nanos = std::chrono::nanoseconds(static_cast<int64_t>(offset));
+        return m_base_wall + std::chrono::duration_cast<std::chrono::system_clock::duration>(nanos);
+    }
+
+   private:
+    int64_t m_base_ticks;
+    std::chrono::system_clock::time_point m_base_wall;
+    double m_ns_per_tick = 1.0;
+
+    // Takes a first measurement over a millisecond, so even the first records get a sensible time
+    LogClock() : m_base_ticks(Now()), m_base_wall(std::chrono::system_clock::now()) {
+        while (std::chrono::system_clock::now() - m_base_wall < std::chrono::milliseconds(1)) {
+            std::this_thread::yield();
+        }
+        Calibrate();
+    }
+};
+
+/**
+ * One log call on its way from the calling thread to the LogProcessor: when, how severe, who, a format string with
+ * static storage duration (e.g. a literal) and the raw arguments. Turning it into text is left to the processor.
+ *
+ * Arguments are numbers or strings. A string is copied into the record if it fits and onto the heap otherwise, so the
+ * record itself is plain bytes and is moved with a memcpy.
+ **/
+struct LogRecord {
+    static constexpr size_t kNameSize = 31;
+    static constexpr size_t kArgsSize = 192;
+
+    // Appends the formatted arguments to `out`. With a null `out` it only releases what the record owns.
+    using Decoder = void (*)(const LogRecord &record, std::string *out);
+
+    int64_t time;  // LogClock ticks
+    const char *format;
+    Decoder decode;
+    Level level;
+    uint8_t name_length;
+    char name[kNameSize];
+    alignas(8) std::byte args[kArgsSize];
+
+    std::string_view Name() const { return {name, name_length}; }
+};
+
+namespace detail {
+
+template <typename T>
+constexpr bool kIsLogString = std::is_convertible_v<const T &, std::string_view>;
+
+// Length prefix of a string that didn't fit. A pointer to a heap copy follows instead of the characters.
+constexpr uint32_t kOnHeap = UINT32_MAX;
+
+// Least room an argument needs in the record
+template <typename T>
+constexpr size_t MinSize() {
+    if constexpr (kIsLogString<T>) {
+        return sizeof(uint32_t) + sizeof(std::string *);
+    } else {
+        static_assert(std::is_arithmetic_v<T>, "Log arguments must be numbers or strings");
+        return sizeof(T);
+    }
+}
+
+class ArgWriter {
+   private:
+    std::byte *m_pos;
+    size_t m_left;
+    size_t m_reserved;  // MinSize() of the arguments still to come
+
+    template <typename T>
+    void Raw(const T &value) {
+        std::memcpy(m_pos, &value, sizeof(T));
+        m_pos += sizeof(T);
+        m_left -= sizeof(T);
+    }
+
+   public:
+    ArgWriter(std::byte *pos, size_t size, size_t reserved) : m_pos(pos), m_left(size), m_reserved(reserved) {}
+
+    template <typename T>
+    void Put(const T &value) {
+        m_reserved -= MinSize<T>();
+        if constexpr (kIsLogString<T>) {
+            std::string_view s(value);
+            if (sizeof(uint32_t) + s.size() + m_reserved <= m_left) {
+                Raw(static_cast<uint32_t>(s.size()));
+                std::memcpy(m_pos, s.data(), s.size());
+                m_pos += s.size();
+                m_left -= s.size();
+            } else {
+                Raw(kOnHeap);
+                Raw(new std::string(s));
+            }
+        } else {
+            Raw(value);
+        }
+    }
+};
+
+template <size_t N>
+class ArgReader {
+   private:
+    const std::byte *m_pos;
+    std::unique_ptr<std::string> m_owned[N + 1];
+    size_t m_owned_count = 0;
+
+    template <typename T>
+    T Raw() {
+        T value;
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+   public:
+    explicit ArgReader(const std::byte *pos) : m_pos(pos) {}
+
+    template <typename T>
+    auto Get() {
+        if constexpr (kIsLogString<T>) {
+            uint32_t size = Raw<uint32_t>();
+            if (size == kOnHeap) {
+                m_owned[m_owned_count].reset(Raw<std::string *>());
+                return std::string_view(*m_owned[m_owned_count++]);
+            }
+            std::string_view s(reinterpret_cast<const char *>(m_pos), size);
+            m_pos += size;
+            return s;
+        } else {
+            return Raw<T>();
+        }
+    }
+};
+
+template <typename... Args>
+void Decode(const LogRecord &record, std::string *out) {
+    ArgReader<sizeof...(Args)> reader(record.args);
+    // Braced initialization reads the arguments left to right
+    std::tuple<decltype(reader.template Get<Args>())...> values{reader.template Get<Args>()...};
+    if (!out) {
+        return;
+    }
+
+    try {
+        std::apply(
+            [&](const auto &...v) {
+                fmt::vformat_to(std::back_inserter(*out), record.format, fmt::make_format_args(v...));
+            },
+            values);
+    } catch (const fmt::format_error &e) {
+        out->append(record.format).append(" (bad log format: ").append(e.what()).append(")");
+    }
+}
+
+}  // namespace detail
+
+/**
+ * The per-thread rings log records travel through.
+ *
+ * Every thread that logs gets a single producer ring of its own on its first call, so the hot path never contends
+ * with other threads: a push is a copy into the ring and one release store. The LogProcessor is the only consumer.
+ **/
+class LogRings {
+   public:
+    static constexpr size_t kRingCapacity = 1024;
+
+    static LogRings &Instance() {
+        static LogRings rings;
+        return rings;
+    }
+
+    /*
+    Queues `record` on the calling thread's ring and wakes the LogProcessor if it is asleep. If the ring is full, WARN
+    and ERROR records go to a shared overflow list instead, which takes a lock but never drops, and the processor is
+    woken right away. Anything less severe is dropped and counted.
+    */
+    void Push(LogRecord &&record) {
+        if (!Local().TryPush(std::move(record))) {
+            if (record.level < Level::WARN) {
+                record.decode(record, nullptr);
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_overflow_mutex);
+                m_overflow.push_back(record);
+                m_overflow_size.store(m_overflow.size(), std::memory_order_release);
+            }
+            Wake();
+            return;
+        }
+
+        if (m_sleeping.load(std::memory_order_relaxed)) {
+            Wake();
+        }
+    }
+
+    // Ends the LogProcessor's current WaitForRecords()
+    void Wake() {
+        std::lock_guard<std::mutex> lock(m_wait_mutex);
+        m_woken = true;
+        m_wait_cv.notify_one();
+    }
+
+    /*
+    LogProcessor only. Returns once a thread has logged something or `timeout` has passed. A wakeup racing with the
+    processor falling asleep can be missed, the timeout bounds how late those records are picked up.
+    */
+    void WaitForRecords(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_wait_mutex);
+        m_sleeping.store(true);
+        if (Size() == 0) {
+            m_wait_cv.wait_for(lock, timeout, [this]() { return m_woken; });
+        }
+        m_woken = false;
+        m_sleeping.store(false);
+    }
+
+    /*
+    LogProcessor only. Moves up to `max` records from every ring into `out`, then from the overflow list, ordered by
+    time. Rings of threads that have exited are dropped once empty. Returns how many records were taken.
+    */
+    size_t DrainTo(std::vector<LogRecord> &out, size_t max) {
+        size_t before = out.size();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto it = m_rings.begin(); it != m_rings.end();) {
+                Ring &ring = **it;
+                bool retired = ring.retired.load();
+                ring.queue.TryPopBatch(std::back_inserter(out), max - (out.size() - before));
+                if (retired && ring.queue.Size() == 0) {
+                    it = m_rings.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        // After the rings, which hold the older records of the threads that overflowed
+        if (m_overflow_size.load(std::memory_order_acquire) > 0 && out.size() - before < max) {
+            std::lock_guard<std::mutex> lock(m_overflow_mutex);
+            size_t n = std::min(m_overflow.size(), max - (out.size() - before));
+            out.insert(out.end(), m_overflow.begin(), m_overflow.begin() + n);
+            m_overflow.erase(m_overflow.begin(), m_overflow.begin() + n);
+            m_overflow_size.store(m_overflow.size(), std::memory_order_release);
+        }
+        std::stable_sort(out.begin() + before, out.end(),
+                         [](const LogRecord &a, const LogRecord &b) { return a.time < b.time; });
+        return out.size() - before;
+    }
+
+    // Records below WARN dropped on full rings since the last call
+    size_t TakeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+    size_t Size() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t size = m_overflow_size.load(std::memory_order_acquire);
+        for (const auto &ring : m_rings) {
+            size += ring->queue.Size();
+        }
+        return size;
+    }
+
+   private:
+    struct Ring {
+        SpscQueue<LogRecord> queue{kRingCapacity};
+        std::atomic<bool> retired{false};
+    };
+
+    // Owned by the thread, retires its ring on thread exit. The ring itself lives on until it has been drained.
+    struct Owner {
+        std::shared_ptr<Ring> ring;
+        ~Owner() {
+            if (ring) {
+                ring->retired.store(true);
+            }
+        }
+    };
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<Ring>> m_rings;
+    std::atomic<size_t> m_dropped{0};
+
+    std::mutex m_overflow_mutex;
+    std::vector<LogRecord> m_overflow;  // WARN and ERROR records that found their ring full
+    std::atomic<size_t> m_overflow_size{0};
+
+    std::mutex m_wait_mutex;
+    std::condition_variable m_wait_cv;
+    std::atomic<bool> m_sleeping{false};
+    bool m_woken = false;
+
+    SpscQueue<LogRecord> &Local() {
+        thread_local Owner owner;
+        if (!owner.ring) {
+            owner.ring = std::make_shared<Ring>();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_rings.push_back(owner.ring);
+        }
+        return owner.ring->queue;
+    }
+};
+
+/*
+Logs `format` (fmt syntax, static storage duration) with `args` without formatting anything on the calling thread,
+e.g. Write(Level::INFO, m_name, "Applied {} edges in {} us", count, micros).
+*/
+template <typename... Args>
+void Write(Level level, std::string_view name, const char *format, const Args &...args) {
+    constexpr size_t kMinSize = (size_t{0} + ... + detail::MinSize<Args>());
+    static_assert(kMinSize <= LogRecord::kArgsSize, "Too many log arguments");
+
+    LogRecord record;
+    record.time = LogClock::Now();
+    record.format = format;
+    record.decode = &detail::Decode<Args...>;
+    record.level = level;
+    record.name_length = static_cast<uint8_t>(std::min(name.size(), LogRecord::kNameSize));
+    std::memcpy(record.name, name.data(), record.name_length);
+
+    detail::ArgWriter writer(record.args, LogRecord::kArgsSize, kMinSize);
+    (writer.Put(args), ...);
+
+    LogRings::Instance().Push(std::move(record));
+}
+
+}  // namespace Logging
+
+#endif
@@ -19,7 +19,7 @@ Logging::FileLogger::FileLogger(const Config &config) : BaseLogger(config) {
 }
 
 void Logging::FileLogger::log(const std::string &message, const Level level, const std::string &name) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
 
@@ -27,7 +27,7 @@ void Logging::FileLogger::log(const std::string &message, const Level level, con
 }
 
 void Logging::FileLogger::log(const std::string &message, const Level level) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
     log(message);
@@ -41,6 +41,16 @@ void Logging::FileLogger::log(const std::string &message) {
     reopen();
 }
 
+void Logging::FileLogger::log_batch(const std::vector<std::string> &messages) {
+    m_lock.lock();
+    for (const auto &message : messages) {
+        m_file.write(message.data(), message.size());
+    }
+    m_file.flush();
+    m_lock.unlock();
+    reopen();
+}
+
 void Logging::FileLogger::reopen() {
     // Periodically close and repone the file handle to make sure the contents of the file buffer
     // are written to disk.
@@ -1,12 +1,15 @@
+#include <vector>
+
 #include "../thread_guard.h"
 #include "logging.h"
 
 static std::string name = "LogProcessor";
-SafeQueue<std::string> log_queue;
+static constexpr size_t kBatchSize = 1024;
 
 Logging::LogProcessor::LogProcessor(std::shared_ptr<LogSignal> log_signal) : m_log_signal(log_signal) {
     // Logging::configure({{"type", "file"}, {"file_name", "flycatcher.log"}, {"reopen_interval", "1"}});
     Logging::configure({{"type", "std_out"}});
+    Logging::LogClock::Instance();
     // Logging::configure({{"type", "daily"}, {"file_name", "logs/oms_master.log"}, {"hour", "2"}, {"minute", "30"}});
 }
 
@@ -17,7 +20,33 @@ bool Logging::LogProcessor::start() {
 
 void Logging::LogProcessor::join() const { ThreadGuard g(*m_t); }
 
+/*
+Formats the records taken off the rings and hands them to the logger in one batch, preceded by a note if records had
+to be dropped since the last call.
+*/
+static void log_records(std::vector<Logging::LogRecord>& records, std::vector<std::string>& lines) {
+    Logging::LogClock::Instance().Calibrate();
+    size_t dropped = Logging::LogRings::Instance().TakeDropped();
+    if (dropped > 0) {
+        lines.emplace_back(Logging::create_log("Log rings full, dropped " + std::to_string(dropped) + " messages",
+                                               Logging::Level::WARN, name));
+    }
+    for (const auto& record : records) {
+        lines.emplace_back(Logging::create_log(record));
+    }
+    if (!lines.empty()) {
+        Logging::log_batch(lines);
+    }
+    records.clear();
+    lines.clear();
+}
+
 void Logging::LogProcessor::run() {
+    LogRings& rings = LogRings::Instance();
+    std::vector<LogRecord> records;
+    std::vector<std::string> lines;
+    records.reserve(kBatchSize);
+    lines.reserve(kBatchSize + 1);
     m_should_run = true;
     while (m_should_run) {
         // Do not log when we have active processors. Processors have priority over logging.
@@ -53,29 +82,30 @@ void Logging::LogProcessor::run() {
         /*
         Read and log
         Important: after unlocking as we don't want to block strategies while waiting for dequeue if queue is empty
+
+        Take whatever piled up on the threads' rings, a batch at a time until they are empty, and write each batch in
+        one go. All the formatting happens here, off the hot threads. Then sleep until someone logs again.
         */
-        std::string message;
-        log_queue.DequeueWithTimeout(10, message);
-        if (!message.empty()) {
-            Logging::log(message);
+        while (rings.DrainTo(records, kBatchSize) == kBatchSize) {
+            log_records(records, lines);
         }
+        log_records(records, lines);
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        rings.WaitForRecords(std::chrono::milliseconds(10));
     }  // end while
 
-    Logging::log("Shutdown requested. Processing remaining " + std::to_string(log_queue.Size()) + " messages...",
+    Logging::log("Shutdown requested. Processing remaining " + std::to_string(rings.Size()) + " messages...",
                  Logging::Level::INFO, name);
-    std::string msg;
-    log_queue.DequeueWithTimeout(1000, msg);
-    while (!msg.empty()) {
-        Logging::log(msg, Logging::Level::INFO);
-        msg.clear();
-        log_queue.DequeueWithTimeout(1000, msg);
+    while (rings.DrainTo(records, kBatchSize) > 0) {
+        log_records(records, lines);
     }
 
     Logging::log("Shutting down", Logging::Level::INFO, name);
 }
 
-void Logging::LogProcessor::stop() { m_should_run = false; }
+void Logging::LogProcessor::stop() {
+    m_should_run = false;
+    LogRings::Instance().Wake();
+}
 
 Logging::LogProcessor::~LogProcessor() {}
\ No newline at end of file
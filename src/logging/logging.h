@@ -4,14 +4,19 @@
  **/
 #ifndef LOGGING_H
 #define LOGGING_H
-#define LOGGING_LEVEL_INFO
+// Compiled in down to DEBUG. What is actually logged is decided at runtime, see set_level().
+#define LOGGING_LEVEL_DEBUG
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iostream>
@@ -22,14 +27,12 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
-#include "../safe_queue.h"
+#include "binary_log.h"
 #include "log_signal.h"
 
-extern SafeQueue<std::string> log_queue;
-
 namespace Logging {
-enum class Level : uint8_t { TRACE = 0, DEBUG = 1, INFO = 2, WARN = 3, ERROR = 4 };
 
 struct level_hashing_function {
     template <typename T>
@@ -58,30 +61,93 @@ constexpr Level LEVEL_CUTOFF = Level::ERROR + 1;
 constexpr Level LEVEL_CUTOFF = Level::INFO;
 #endif
 
+// Least severe level logged, adjustable at runtime. Levels below LEVEL_CUTOFF aren't even compiled in.
+inline std::atomic<Level> runtime_level{std::max(Level::INFO, LEVEL_CUTOFF)};
+
+inline void set_level(const Level level) { runtime_level.store(std::max(level, LEVEL_CUTOFF)); }
+
+inline Level get_level() { return runtime_level.load(std::memory_order_relaxed); }
+
+// One relaxed load, and for levels below LEVEL_CUTOFF a compile time false.
+inline bool enabled(const Level level) { return level >= LEVEL_CUTOFF && level >= get_level(); }
+
+// Parses "trace", "debug", "info", "warn" or "error". Returns false for anything else.
+inline bool parse_level(const std::string &name, Level &level) {
+    static const std::unordered_map<std::string, Level> levels{{"trace", Level::TRACE},
+                                                               {"debug", Level::DEBUG},
+                                                               {"info", Level::INFO},
+                                                               {"warn", Level::WARN},
+                                                               {"error", Level::ERROR}};
+    auto found = levels.find(name);
+    if (found == levels.end()) {
+        return false;
+    }
+    level = found->second;
+    return true;
+}
+
 /**
-    Timestamp as: year/mo/dy hr:mn:sc.xxxxxx
-*/
-inline std::string timestamp() {
-    std::chrono::system_clock::time_point tp =
-        std::chrono::system_clock::now();  // Implementation dependant: microseconds or nanoseconds.
-    std::time_t tt = std::chrono::system_clock::to_time_t(tp);  // Seconds since the Epoch
-    std::tm gmt{};
-    gmtime_r(&tt, &gmt);
-
-    // from_time_t(...) returns "rounded" value
-    // 1 microsecond = 0.000001 seconds
-    // 1 nanosecond = 0.000000001 seconds or 1000 000 000ns = 1s
-    // (1 668 496 399 029 524 297ns - 1 668 496 399 000 000 000ns) + gmt.tm_sec = 29 524 297ns + 19s = 19.029s
-    std::chrono::duration<double> fractional_seconds =
-        (tp - std::chrono::system_clock::from_time_t(tt)) + std::chrono::seconds(gmt.tm_sec);
-
-    std::stringstream s;
-    s << gmt.tm_year + 1900 << "/" << gmt.tm_mon + 1 << "/" << gmt.tm_mday << " " << gmt.tm_hour << ":" << gmt.tm_min
-      << "." << fractional_seconds.count();
-
-    return s.str();
+ * Formats timestamps as year/mo/dy hr:mn:sc.xxxxxx (UTC), e.g. 2024/03/07 09:15:02.048113.
+ *
+ * Everything up to the seconds only changes once a second, so it is formatted once and cached. A call in the same
+ * second as the previous one only writes the six digits of the microseconds.
+ **/
+class TimestampFormatter {
+   public:
+    static constexpr size_t kLength = 26;
+
+    void Append(std::chrono::system_clock::time_point tp, std::string &out) {
+        int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(tp.time_since_epoch()).count();
+        int64_t second = micros / 1000000;
+        int64_t fraction = micros % 1000000;
+        if (fraction < 0) {
+            second -= 1;
+            fraction += 1000000;
+        }
+        if (second != m_second) {
+            Format(second);
+        }
+
+        char buffer[kLength];
+        std::memcpy(buffer, m_prefix, kPrefixLength);
+        for (size_t i = kLength; i > kPrefixLength; --i) {
+            buffer[i - 1] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+        out.append(buffer, kLength);
+    }
+
+   private:
+    static constexpr size_t kPrefixLength = 20;  // "year/mo/dy hr:mn:sc."
+
+    int64_t m_second = INT64_MIN;
+    char m_prefix[kPrefixLength + 1];
+
+    void Format(int64_t second) {
+        std::time_t tt = static_cast<std::time_t>(second);
+        std::tm gmt{};
+        gmtime_r(&tt, &gmt);
+        std::snprintf(m_prefix, sizeof(m_prefix), "%04d/%02d/%02d %02d:%02d:%02d.", (gmt.tm_year + 1900) % 10000,
+                      gmt.tm_mon + 1, gmt.tm_mday, gmt.tm_hour, gmt.tm_min, gmt.tm_sec);
+        m_second = second;
+    }
+};
+
+// Appends the timestamp of `tp` to `out`. Each thread has its own cache, so sinks can call it from anywhere.
+inline void append_timestamp(std::string &out, std::chrono::system_clock::time_point tp) {
+    thread_local TimestampFormatter formatter;
+    formatter.Append(tp, out);
 }
 
+inline std::string timestamp(std::chrono::system_clock::time_point tp) {
+    std::string s;
+    s.reserve(TimestampFormatter::kLength);
+    append_timestamp(s, tp);
+    return s;
+}
+
+inline std::string timestamp() { return timestamp(std::chrono::system_clock::now()); }
+
 using Config = std::unordered_map<std::string, std::string>;
 
 /**
@@ -98,6 +164,13 @@ class BaseLogger {
     virtual void log(const std::string &, const Level, const std::string &name){};
     virtual void log(const std::string &message, const Level level){};
     virtual void log(const std::string &){};
+
+    // Writes already formatted lines. Sinks override it to write the whole batch at once and flush only once.
+    virtual void log_batch(const std::vector<std::string> &messages) {
+        for (const auto &message : messages) {
+            log(message);
+        }
+    }
 };
 
 /**
@@ -110,6 +183,7 @@ class StdOutLogger : public BaseLogger {
     virtual void log(const std::string &message, const Level level, const std::string &name) override;
     virtual void log(const std::string &message, const Level level) override;
     virtual void log(const std::string &message) override;
+    virtual void log_batch(const std::vector<std::string> &messages) override;
 };
 
 /**
@@ -122,6 +196,7 @@ class FileLogger : public BaseLogger {
     virtual void log(const std::string &message, const Level level, const std::string &name) override;
     virtual void log(const std::string &message, const Level level) override;
     virtual void log(const std::string &message) override;
+    virtual void log_batch(const std::vector<std::string> &messages) override;
 
    protected:
     void reopen();
@@ -141,6 +216,7 @@ class SpdLogger : public BaseLogger {
     virtual void log(const std::string &message, const Level level, const std::string &name) override;
     virtual void log(const std::string &message, const Level level) override;
     virtual void log(const std::string &message) override;
+    virtual void log_batch(const std::vector<std::string> &messages) override;
 
    protected:
     std::string m_file_name;
@@ -181,7 +257,7 @@ inline std::string create_log(const std::string &message, const Level level, con
 
     std::size_t len = name.length() + message.length() + 64;
     output.reserve(len);
-    output.append(timestamp());
+    append_timestamp(output, std::chrono::system_clock::now());
     output.append(prefix.find(level)->second);
     output.append("[");
     output.append(name);
@@ -191,6 +267,20 @@ inline std::string create_log(const std::string &message, const Level level, con
     return output;
 }
 
+// Formats a record taken off the LogRings, see LogProcessor
+inline std::string create_log(const LogRecord &record) {
+    std::string output;
+    output.reserve(record.name_length + 128);
+    append_timestamp(output, LogClock::Instance().ToSystem(record.time));
+    output.append(prefix.find(record.level)->second);
+    output.append("[");
+    output.append(record.Name());
+    output.append("] ");
+    record.decode(record, &output);
+    output.append("\n");
+    return output;
+}
+
 // statically log
 inline void log(const std::string &message, const Level level, const std::string &name) {
     get_logger().log(message, level, name);
@@ -201,51 +291,169 @@ inline void log(const std::string &message, const Level level) { get_logger().lo
 // statically log manually without a level
 inline void log(const std::string &message) { get_logger().log(message); }
 
+inline void log_batch(const std::vector<std::string> &messages) { get_logger().log_batch(messages); }
+
 inline void TRACE(const std::string &message, const std::string &name = "") {
-    if (LEVEL_CUTOFF > Level::TRACE) {
+    if (!enabled(Level::TRACE)) {
         return;
     }
 
-    log_queue.Enqueue(create_log(message, Level::TRACE, name));
+    Write(Level::TRACE, name, "{}", message);
 }
 
 inline void DEBUG(const std::string &message, const std::string &name = "") {
-    if (LEVEL_CUTOFF > Level::DEBUG) {
+    if (!enabled(Level::DEBUG)) {
         return;
     }
 
-    log_queue.Enqueue(create_log(message, Level::DEBUG, name));
+    Write(Level::DEBUG, name, "{}", message);
 }
 
 inline void INFO(const std::string &message, const std::string &name = "") {
     // get_logger().log(message, Level::INFO);
-    if (LEVEL_CUTOFF > Level::INFO) {
+    if (!enabled(Level::INFO)) {
         return;
     }
 
-    log_queue.Enqueue(create_log(message, Level::INFO, name));
+    Write(Level::INFO, name, "{}", message);
 }
 
 inline void WARN(const std::string &message, const std::string &name = "") {
-    if (LEVEL_CUTOFF > Level::WARN) {
+    if (!enabled(Level::WARN)) {
         return;
     }
 
-    log_queue.Enqueue(create_log(message, Level::WARN, name));
+    Write(Level::WARN, name, "{}", message);
 }
 
 // TODO: Give LogProccessor priority on ERROR so that we don't miss any errors
 inline void ERROR(const std::string &message, const std::string &name = "") {
-    log_queue.Enqueue(create_log(message, Level::ERROR, name));
+    Write(Level::ERROR, name, "{}", message);
+}
+
+/**
+ * Lets one call per `interval` through, see LOG_EVERY_MS. Shared by all threads passing the call site. A suppressed
+ * call costs a clock read and an atomic increment.
+ **/
+class RateLimiter {
+   public:
+    explicit RateLimiter(std::chrono::milliseconds interval)
+        : m_interval(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count()) {}
+
+    // True if this call should be logged. `repeated` is set to how many calls were suppressed since the last one was.
+    bool Allow(size_t &repeated) {
+        int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+        int64_t next = m_next.load(std::memory_order_relaxed);
+        if (now < next || !m_next.compare_exchange_strong(next, now + m_interval)) {
+            m_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        repeated = m_suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+   private:
+    const int64_t m_interval;
+    std::atomic<int64_t> m_next{INT64_MIN};
+    std::atomic<size_t> m_suppressed{0};
+};
+
+/**
+ * Lets every `n`th call through, starting with the first, see LOG_EVERY_N.
+ **/
+class Sampler {
+   public:
+    explicit Sampler(size_t n) : m_n(std::max<size_t>(n, 1)) {}
+
+    // True if this call should be logged. `repeated` is set to how many calls were skipped since the last one was.
+    bool Allow(size_t &repeated) {
+        size_t count = m_count.fetch_add(1, std::memory_order_relaxed);
+        if (count % m_n != 0) {
+            return false;
+        }
+        repeated = count == 0 ? 0 : m_n - 1;
+        return true;
+    }
+
+   private:
+    const size_t m_n;
+    std::atomic<size_t> m_count{0};
+};
+
+// 1203442 -> "1,203,442"
+inline std::string grouped(size_t n) {
+    std::string digits = std::to_string(n);
+    std::string out;
+    out.reserve(digits.size() + digits.size() / 3);
+    for (size_t i = 0; i < digits.size(); ++i) {
+        if (i > 0 && (digits.size() - i) % 3 == 0) {
+            out.push_back(',');
+        }
+        out.push_back(digits[i]);
+    }
+    return out;
 }
 
+}  // namespace Logging
+
+/*
+Log with fmt style arguments, e.g. LOG_DEBUG(m_name, "Pushing vertex '{}' to worker '{}'", key, address). Unlike the
+functions above, the arguments aren't evaluated at all unless the level is enabled. Strings are best passed as they
+are (or as std::string_view) instead of concatenated, they are copied straight into the log record.
+*/
+#define LOG_AT(level, name, ...)                            \
+    do {                                                    \
+        if (::Logging::enabled(level)) {                    \
+            ::Logging::Write((level), (name), __VA_ARGS__); \
+        }                                                   \
+    } while (0)
+
+#define LOG_TRACE(name, ...) LOG_AT(::Logging::Level::TRACE, name, __VA_ARGS__)
+#define LOG_DEBUG(name, ...) LOG_AT(::Logging::Level::DEBUG, name, __VA_ARGS__)
+#define LOG_INFO(name, ...) LOG_AT(::Logging::Level::INFO, name, __VA_ARGS__)
+#define LOG_WARN(name, ...) LOG_AT(::Logging::Level::WARN, name, __VA_ARGS__)
+#define LOG_ERROR(name, ...) LOG_AT(::Logging::Level::ERROR, name, __VA_ARGS__)
+
+/*
+For call sites that can fire in a storm (e.g. every retry while a worker is down). Each call site gets its own limit,
+shared by all threads passing it. `format` has to be a string literal.
+
+LOG_EVERY_MS logs at most once per `interval_ms`, LOG_EVERY_N logs the first and then every `n`th call. Once calls were
+suppressed, the next line logged says how many, e.g. "Worker unhealthy (repeated 1,203,442 times)". A storm that just
+stops leaves its last count unreported until the call site fires again.
+*/
+#define LOG_LIMITED(Limiter, limit, level, name, format, ...)                                               \
+    do {                                                                                                    \
+        static Limiter log_limiter_(limit);                                                                 \
+        size_t log_repeated_ = 0;                                                                           \
+        if (::Logging::enabled(level) && log_limiter_.Allow(log_repeated_)) {                               \
+            if (log_repeated_ > 0) {                                                                        \
+                ::Logging::Write((level), (name), format " (repeated {} times)" __VA_OPT__(, ) __VA_ARGS__, \
+                                 ::Logging::grouped(log_repeated_));                                        \
+            } else {                                                                                        \
+                ::Logging::Write((level), (name), format __VA_OPT__(, ) __VA_ARGS__);                       \
+            }                                                                                               \
+        }                                                                                                   \
+    } while (0)
+
+#define LOG_EVERY_MS(level, interval_ms, name, format, ...)                                                         \
+    LOG_LIMITED(::Logging::RateLimiter, std::chrono::milliseconds(interval_ms), level, name, format __VA_OPT__(, ) \
+                    __VA_ARGS__)
+
+#define LOG_EVERY_N(level, n, name, format, ...) \
+    LOG_LIMITED(::Logging::Sampler, n, level, name, format __VA_OPT__(, ) __VA_ARGS__)
+
+namespace Logging {
+
 /**
  * Thread that picks up log events from the queue and actually logs them.
  *
  **/
 class LogProcessor {
    private:
-    bool m_should_run;
+    std::atomic<bool> m_should_run = false;
     std::unique_ptr<std::thread> m_t;
     std::shared_ptr<LogSignal> m_log_signal;
     void run();
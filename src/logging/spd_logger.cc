@@ -28,12 +28,13 @@ Logging::SpdLogger::SpdLogger(const Config &config) : BaseLogger(config) {
     m_logger->set_level(spdlog::level::trace);
     m_logger->sinks()[0]->set_pattern("%v");
     m_logger->sinks()[1]->set_pattern("%v");
-    m_logger->flush_on(spdlog::level::trace);
+    // Flushed explicitly, once per batch rather than once per message
+    m_logger->flush_on(spdlog::level::off);
     spdlog::register_logger(m_logger);
 }
 
 void Logging::SpdLogger::log(const std::string &message, const Level level, const std::string &name) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
 
@@ -41,10 +42,20 @@ void Logging::SpdLogger::log(const std::string &message, const Level level, cons
 }
 
 void Logging::SpdLogger::log(const std::string &message, const Level level) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
     log(message);
 }
 
-void Logging::SpdLogger::log(const std::string &message) { m_logger->trace(message); }
\ No newline at end of file
+void Logging::SpdLogger::log(const std::string &message) {
+    m_logger->trace(message);
+    m_logger->flush();
+}
+
+void Logging::SpdLogger::log_batch(const std::vector<std::string> &messages) {
+    for (const auto &message : messages) {
+        m_logger->trace(message);
+    }
+    m_logger->flush();
+}
\ No newline at end of file
@@ -1,16 +1,23 @@
+#include <limits.h>  // IOV_MAX
+#include <sys/uio.h>  // writev()
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+
 #include "logging.h"
 
 Logging::StdOutLogger::StdOutLogger(const Config &config) : BaseLogger(config) {}
 
 void Logging::StdOutLogger::log(const std::string &message, const Logging::Level level, const std::string &name) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
     log(Logging::create_log(message, level, name));
 }
 
 void Logging::StdOutLogger::log(const std::string &message, const Level level) {
-    if (level < LEVEL_CUTOFF) {
+    if (!enabled(level)) {
         return;
     }
     log(message);
@@ -24,4 +31,44 @@ void Logging::StdOutLogger::log(const std::string &message) {
     // std::lock_guard<std::mutex> lk{lock};
     std::cout << message;
     std::cout.flush();
+}
+
+void Logging::StdOutLogger::log_batch(const std::vector<std::string> &messages) {
+    // Whatever went through std::cout before has to come out first
+    std::cout.flush();
+
+    /*
+    One writev() per IOV_MAX lines instead of a write and a flush per line. A short write (e.g. a full pipe) continues
+    where it stopped.
+    */
+    std::vector<iovec> iov;
+    iov.reserve(std::min<size_t>(messages.size(), IOV_MAX));
+    for (size_t first = 0; first < messages.size(); first += IOV_MAX) {
+        size_t last = std::min<size_t>(messages.size(), first + IOV_MAX);
+        iov.clear();
+        for (size_t i = first; i < last; ++i) {
+            iov.push_back({const_cast<char *>(messages[i].data()), messages[i].size()});
+        }
+
+        iovec *pending = iov.data();
+        int count = static_cast<int>(iov.size());
+        while (count > 0) {
+            ssize_t written = ::writev(STDOUT_FILENO, pending, count);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            while (count > 0 && static_cast<size_t>(written) >= pending->iov_len) {
+                written -= pending->iov_len;
+                ++pending;
+                --count;
+            }
+            if (count > 0) {
+                pending->iov_base = static_cast<char *>(pending->iov_base) + written;
+                pending->iov_len -= written;
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
-#include <signal.h>     // kill()
+#include <signal.h>  // kill()
+#ifdef __APPLE__
 #include <sys/event.h>  // kqueue
+#endif
 
 #include <chrono>
 #include <iostream>
@@ -9,22 +11,41 @@
 #include <vector>
 
 #include "config/config_parser.h"
+#include "executor.h"
 #include "kafka/kafka_builder.h"
 #include "kafka/kafka_data_source.h"
+#include "kafka/kafka_edge_batch_message_strategy.h"
 #include "kafka/kafka_message_strategy.h"
 #include "kafka/kafka_print_message_strategy.h"
 #include "kafka/kafka_strategy_factory.h"
-#include "lock_free_queue.h"
 #include "logging/log_signal.h"
 #include "logging/logging.h"
 #include "orchestrator/api_runner.h"
 #include "orchestrator/health_checker.h"
+#include "orchestrator/ingest_shard.h"
 #include "orchestrator/orchestrator_builder.h"
+#include "payload.h"
+#include "replay/file_replay_builder.h"
+#include "rpc_scheduler.h"
 #include "safe_queue.h"
+#include "sharded_queue.h"
 #include "signal_channel.h"
+#include "spsc_queue.h"
 #include "thread_dispatcher.h"
 static std::string name = "Main";
 
+/**
+ * Numeric config value or fallback if the key is missing.
+ *
+ */
+size_t ConfigValue(const std::map<std::string, std::string>& config, const std::string& key, size_t fallback) {
+    auto it = config.find(key);
+    if (it == config.end()) {
+        return fallback;
+    }
+    return std::stoul(it->second);
+}
+
 /**
  * Create a return a shared channel for SIGINT signals.
  *
@@ -39,21 +60,19 @@ std::shared_ptr<SignalChannel> ListenForSigint(sigset_t& sigset) {
     sigaddset(&sigset, SIGTERM);
     pthread_sigmask(SIG_BLOCK, &sigset, nullptr);
 
-    std::thread signal_handler{[&sig_channel, &sigset]() {
+    // sig_channel by value, the thread outlives this function
+    std::thread signal_handler{[sig_channel, &sigset]() {
         int signum = 0;
 
         // wait untl a signal is delivered
         sigwait(&sigset, &signum);
-        sig_channel->m_shutdown_requested.store(true);
-
-        // notify all waiting workers to check their predicate
-        sig_channel->m_cv.notify_all();
+        sig_channel->RequestShutdown();
         std::cout << "Received signal " << signum << "\n";
         return signum;
     }};
     signal_handler.detach();
 #elif __APPLE__
-    std::thread signal_handler{[&sig_channel]() {
+    std::thread signal_handler{[sig_channel]() {
         int kq = kqueue();
 
         /* Two kevent structs */
@@ -79,8 +98,7 @@ std::shared_ptr<SignalChannel> ListenForSigint(sigset_t& sigset) {
         switch (ke->filter) {
             case EVFILT_SIGNAL:
                 std::cout << "Received signal " << strsignal(ke->ident) << "\n";
-                sig_channel->m_shutdown_requested.store(true);
-                sig_channel->m_cv.notify_all();
+                sig_channel->RequestShutdown();
                 break;
             default:
                 break;
@@ -128,6 +146,29 @@ int main(int argc, char** argv) {
     ConfigParser& config = ConfigParser::instance(config_file);
 
     std::map<std::string, std::string> workers_config = config.Workers();
+    std::map<std::string, std::string> ingest_config = config.Ingest();
+    size_t kafka_consumers = ConfigValue(ingest_config, "consumers", 1);
+    size_t ingest_shards = ConfigValue(ingest_config, "shards", std::max(1u, std::thread::hardware_concurrency()));
+    size_t ingest_batch = ConfigValue(ingest_config, "batch", 256);
+    size_t queue_capacity = ConfigValue(ingest_config, "queue_capacity", 65536);
+    size_t high_watermark = ConfigValue(ingest_config, "high_watermark", 10000);
+    size_t low_watermark = ConfigValue(ingest_config, "low_watermark", high_watermark / 2);
+    size_t commit_interval_ms = ConfigValue(ingest_config, "commit_interval_ms", 1000);
+    size_t vertex_cache = ConfigValue(ingest_config, "vertex_cache", 1000000);
+    bool undirected = !ingest_config.count("undirected") || ingest_config["undirected"] != "false";
+    std::string ingest_format = ingest_config.count("format") ? ingest_config["format"] : "json";
+    std::map<std::string, std::string> replay_config;
+    if (config.has_key("replay")) {
+        replay_config = config.Replay();
+    }
+    std::map<std::string, std::string> executor_config;
+    if (config.has_key("executor")) {
+        executor_config = config.Executor();
+    }
+    std::map<std::string, std::string> logging_config;
+    if (config.has_key("logging")) {
+        logging_config = config.Log();
+    }
 
     /*************************************************************************
      *
@@ -146,16 +187,56 @@ int main(int argc, char** argv) {
     Logging::LogProcessor log_processor(log_signal);
     log_processor.start();
 
+    if (logging_config.count("level")) {
+        Logging::Level log_level;
+        if (!Logging::parse_level(logging_config["level"], log_level)) {
+            throw std::runtime_error("Unknown log level '" + logging_config["level"] + "'");
+        }
+        Logging::set_level(log_level);
+    }
+
+    /*************************************************************************
+     *
+     * EXECUTOR
+     *
+     *************************************************************************/
+    /*
+    One pool for all the polling and fan-out below instead of a thread per component. Declared before everything
+    that posts to it so it is destroyed last.
+    */
+    std::shared_ptr<Executor> executor = std::make_shared<Executor>(ConfigValue(executor_config, "threads", 0),
+                                                                    executor_config["pin_threads"] == "true");
+    Logging::INFO("Executor running " + std::to_string(executor->Size()) + " threads", name);
+
+    // Completion queue threads driving the calls to the workers. They only resume coroutines, a few go a long way.
+    std::shared_ptr<RpcScheduler> rpc_scheduler =
+        std::make_shared<RpcScheduler>(ConfigValue(executor_config, "rpc_threads", 1));
+    // Connections to each worker. One HTTP/2 connection caps the throughput of heavy fan-out
+    size_t channels_per_worker = ConfigValue(executor_config, "channels_per_worker", 1);
+
     /*************************************************************************
      *
      * ORCHESTRATOR
      *
      *************************************************************************/
     Logging::INFO("Init orchestrator", name);
-    std::shared_ptr<LockFreeQueue<std::string>> graph_queue = std::make_shared<LockFreeQueue<std::string>>();
+    /*
+    Every producer (the replay or each Kafka consumer) gets a queue of its own, so each shard has exactly one producer
+    and one consumer and the handoff doesn't need any MPMC synchronization.
+    */
+    size_t producers = replay_config.empty() ? kafka_consumers : 1;
+    std::vector<std::shared_ptr<ShardedQueue<Payload, SpscQueue>>> graph_queues;
+    for (size_t i = 0; i < producers; ++i) {
+        graph_queues.emplace_back(std::make_shared<ShardedQueue<Payload, SpscQueue>>(ingest_shards, queue_capacity));
+    }
     OrchestratorBuilder orchestrator_builder;
-    std::shared_ptr<GraphOrchestrator> orchestrator =
-        orchestrator_builder.WithName("Orchestrator").WithWorkers(workers_config).WithInputQueue(graph_queue).Build();
+    std::shared_ptr<GraphOrchestrator> orchestrator = orchestrator_builder.WithName("Orchestrator")
+                                                          .WithWorkers(workers_config)
+                                                          .WithVertexCache(vertex_cache)
+                                                          .WithUndirectedEdges(undirected)
+                                                          .WithRpcScheduler(rpc_scheduler)
+                                                          .WithChannelsPerWorker(channels_per_worker)
+                                                          .Build();
 
     /*************************************************************************
      *
@@ -163,7 +244,7 @@ int main(int argc, char** argv) {
      *
      *************************************************************************/
     std::unique_ptr<HealthChecker> checker = std::make_unique<HealthChecker>("HealthChecker", orchestrator);
-    ThreadDispatcher graph_health_checker(std::move(checker), sig_channel, log_signal);
+    ThreadDispatcher graph_health_checker(std::move(checker), sig_channel, log_signal, executor);
 
     while (!orchestrator->Healthy()) {
         Logging::INFO("Waiting for orchestrator to become healthy", name);
@@ -172,7 +253,28 @@ int main(int argc, char** argv) {
     }
 
     orchestrator->Init();
-    ThreadDispatcher graph_poller(orchestrator, sig_channel, log_signal);
+
+    /*************************************************************************
+     *
+     * INGEST SHARDS
+     *
+     *************************************************************************/
+    Logging::INFO("Init " + std::to_string(ingest_shards) + " ingest shards", name);
+    std::vector<std::unique_ptr<ThreadDispatcher>> shard_pollers;
+    for (size_t i = 0; i < ingest_shards; ++i) {
+        std::vector<std::shared_ptr<SpscQueue<Payload>>> lanes;
+        for (const auto& graph_queue : graph_queues) {
+            lanes.push_back(graph_queue->Shard(i));
+        }
+        std::shared_ptr<IngestShard> shard = std::make_shared<IngestShard>(
+            "IngestShard-" + std::to_string(i), orchestrator, std::move(lanes), ingest_batch);
+
+        // Wake the shard as soon as any producer hands it something instead of waiting out its backoff
+        for (const auto& graph_queue : graph_queues) {
+            graph_queue->OnPush(i, [shard]() { shard->Notify(); });
+        }
+        shard_pollers.emplace_back(std::make_unique<ThreadDispatcher>(shard, sig_channel, log_signal, executor));
+    }
 
     /*************************************************************************
      *
@@ -182,6 +284,35 @@ int main(int argc, char** argv) {
     Logging::INFO("Init API", name);
     ApiRunner api_runner(orchestrator, sig_channel, log_signal);
 
+    /*************************************************************************
+     *
+     * FILE REPLAY
+     *
+     *************************************************************************/
+    /*
+    A replay section replaces Kafka as the ingest source, e.g. for backfills or local benchmarks.
+    */
+    std::unique_ptr<ThreadDispatcher> replay_poller;
+    if (!replay_config.empty()) {
+        size_t replay_high_watermark = ConfigValue(replay_config, "high_watermark", 4 * ingest_shards);
+        size_t replay_low_watermark = ConfigValue(replay_config, "low_watermark", replay_high_watermark / 2);
+        PayloadFormat replay_format =
+            replay_config["format"] == "edge_batch" ? PayloadFormat::EDGE_BATCH : PayloadFormat::NDJSON;
+
+        std::shared_ptr<FileReplayDataSource> replay =
+            FileReplayBuilder()
+                .WithName("Replay")
+                .WithPath(replay_config["path"])
+                .WithFormat(replay_format)
+                .WithOutputQueue(graph_queues[0])
+                .WithBatchSize(ConfigValue(replay_config, "batch", 1024))
+                .WithWatermarks(replay_high_watermark, replay_low_watermark)
+                .WithCheckpointInterval(ConfigValue(replay_config, "checkpoint_interval_ms", 1000))
+                .Build();
+        replay_poller = std::make_unique<ThreadDispatcher>(replay, sig_channel, log_signal, executor);
+        kafka_consumers = 0;
+    }
+
     /*************************************************************************
      *
      * KAFKA
@@ -189,26 +320,44 @@ int main(int argc, char** argv) {
      *************************************************************************/
     std::map<std::string, std::string> kafka_config = config.kafka();
 
-    std::unique_ptr<KafkaMessageStrategy> ptr = KafkaFactory::GetInstance("PrintType", "Printer");
-
-    dynamic_cast<KafkaPrintMessageStrategy*>(ptr.get())->m_output_queue = graph_queue;
-
-    std::shared_ptr<KafkaDataSource> kafka =
-        KafkaBuilder()
-            .WithName("Kafka")
-            .WithBootstrapServers(kafka_config["bootstrap.servers"])
-            .WithClientId(kafka_config["client.id"])
-            .WithGroupId("foo")
-            .WithDeliveryReportCallback(std::move(std::make_unique<KafkaDeliveryReportCb>()))
-            .WithTopics({"graph_data"})
-            .WithKafkaMessageStrategy(std::move(ptr))
-            .Build();
-
-    ThreadDispatcher kafka_poller(kafka, sig_channel, log_signal);
-
-    while (!sig_channel->m_shutdown_requested.load()) {
+    /*
+    All consumers join the same group, so Kafka spreads the topic partitions across them.
+    */
+    std::vector<std::unique_ptr<ThreadDispatcher>> kafka_pollers;
+    for (size_t i = 0; i < kafka_consumers; ++i) {
+        std::string suffix = "-" + std::to_string(i);
+        std::string strategy_type = ingest_format == "edge_batch" ? "EdgeBatchType" : "PrintType";
+        std::unique_ptr<KafkaMessageStrategy> ptr = KafkaFactory::GetInstance(strategy_type, "Printer" + suffix);
+
+        /*
+        Both strategies are mentioned explicitly so that the linker keeps their registrations (see
+        kafka_print_message_strategy.cc).
+        */
+        if (dynamic_cast<KafkaEdgeBatchMessageStrategy*>(ptr.get())) {
+            Logging::INFO("Consuming edge batches", "Kafka" + suffix);
+        }
+        dynamic_cast<KafkaPrintMessageStrategy*>(ptr.get())->m_output_queue = graph_queues[i];
+
+        std::shared_ptr<KafkaDataSource> kafka =
+            KafkaBuilder()
+                .WithName("Kafka" + suffix)
+                .WithBootstrapServers(kafka_config["bootstrap.servers"])
+                .WithClientId(kafka_config["client.id"] + suffix)
+                .WithGroupId("foo")
+                .WithDeliveryReportCallback(std::move(std::make_unique<KafkaDeliveryReportCb>()))
+                .WithTopics({"graph_data"})
+                .WithKafkaMessageStrategy(std::move(ptr))
+                .WithBatchSize(ingest_batch)
+                .WithWatermarks(high_watermark, low_watermark)
+                .WithCommitInterval(commit_interval_ms)
+                .Build();
+
+        kafka_pollers.emplace_back(std::make_unique<ThreadDispatcher>(kafka, sig_channel, log_signal, executor));
     }
 
+    // Everything runs on its own threads now. Sleep until someone asks us to stop.
+    sig_channel->WaitForShutdown();
+
     log_processor.stop();
     log_processor.join();
 }
@@ -0,0 +1,94 @@
+#ifndef OFFSET_TRACKER_H
+#define OFFSET_TRACKER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Keeps track of which offsets of a partitioned source (Kafka topic partitions, replayed files, ...) have been fully
+ * processed, to know how far it is safe to commit.
+ *
+ * Offsets are handed out in order by the source (Track) but may complete out of order (Done), e.g. because they are
+ * applied by different shards. The committable position of a partition is one past the longest prefix of tracked
+ * offsets that are all done. Everything before it has been processed, everything after it is replayed on restart.
+ *
+ * Thread safe. Sources call Track() and Committable(), consumers call Done().
+ **/
+class OffsetTracker {
+   public:
+    struct Position {
+        std::string topic;
+        int32_t partition;
+        int64_t offset;  // next offset to process, i.e. the one to commit
+    };
+
+    void Track(const std::string &topic, int32_t partition, int64_t offset) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_partitions[{topic, partition}].in_flight.emplace(offset, false);
+    }
+
+    void Done(const std::string &topic, int32_t partition, int64_t offset) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_partitions.find({topic, partition});
+        if (it == m_partitions.end()) {
+            // Partition was forgotten (e.g. revoked) while the offset was in flight
+            return;
+        }
+
+        PartitionState &state = it->second;
+        auto offset_it = state.in_flight.find(offset);
+        if (offset_it == state.in_flight.end()) {
+            return;
+        }
+        offset_it->second = true;
+
+        while (!state.in_flight.empty() && state.in_flight.begin()->second) {
+            state.committable = state.in_flight.begin()->first + 1;
+            state.in_flight.erase(state.in_flight.begin());
+        }
+    }
+
+    // Positions that moved since the previous call.
+    std::vector<Position> Committable() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<Position> positions;
+        for (auto &[key, state] : m_partitions) {
+            if (state.committable > state.committed) {
+                positions.push_back({key.first, key.second, state.committable});
+                state.committed = state.committable;
+            }
+        }
+        return positions;
+    }
+
+    // Offsets still being processed across all partitions.
+    size_t InFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t count = 0;
+        for (const auto &[key, state] : m_partitions) {
+            count += state.in_flight.size();
+        }
+        return count;
+    }
+
+    void Forget(const std::string &topic, int32_t partition) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_partitions.erase({topic, partition});
+    }
+
+   private:
+    struct PartitionState {
+        std::map<int64_t, bool> in_flight;  // offset -> done
+        int64_t committable = -1;
+        int64_t committed = -1;
+    };
+
+    std::mutex m_mutex;
+    std::map<std::pair<std::string, int32_t>, PartitionState> m_partitions;
+};
+
+#endif
@@ -0,0 +1,151 @@
+#include "edge_decoder.h"
+
+namespace {
+
+// The next buffer of `pool` for this group, reusing one left by an earlier group if there is one
+template <typename T>
+T& Take(std::deque<T>& pool, size_t& used) {
+    if (used == pool.size()) {
+        pool.emplace_back();
+    }
+    return pool[used++];
+}
+
+}  // namespace
+
+void EdgeDecoder::Reset() {
+    m_strings_used = 0;
+    m_batches_used = 0;
+}
+
+bool EdgeDecoder::Decode(const Payload& payload, std::vector<EdgeView>& edges) {
+    m_malformed = 0;
+    if (payload.Size() == 0) {
+        return false;
+    }
+
+    switch (payload.Format()) {
+        case PayloadFormat::JSON_EDGE:
+            return DecodeJson(payload.Data(), edges);
+        case PayloadFormat::EDGE_BATCH:
+            return DecodeEdgeBatch(payload.Data(), edges);
+        case PayloadFormat::NDJSON:
+            return DecodeNdjson(payload.Data(), edges);
+    }
+    return false;
+}
+
+/*
+{"from": "a","to": "b","label": "friend"}
+*/
+bool EdgeDecoder::DecodeJson(std::string_view bytes, std::vector<EdgeView>& edges) {
+    EdgeView edge;
+    if (!ParseJson(bytes, edge)) {
+        return false;
+    }
+
+    std::string& strings = Take(m_strings, m_strings_used);
+    strings.assign(edge.from).append(edge.to).append(edge.label);
+    std::string_view copy(strings);
+    edges.push_back({copy.substr(0, edge.from.size()), copy.substr(edge.from.size(), edge.to.size()),
+                     copy.substr(edge.from.size() + edge.to.size())});
+    return true;
+}
+
+/*
+{"from": "a","to": "b","label": "friend"}
+{"from": "b","to": "c","label": "friend"}
+
+Bulk files shouldn't lose a whole chunk to one bad line, so malformed lines are skipped and counted instead.
+*/
+bool EdgeDecoder::DecodeNdjson(std::string_view bytes, std::vector<EdgeView>& edges) {
+    std::string& strings = Take(m_strings, m_strings_used);
+    strings.clear();
+    m_string_ends.clear();
+
+    size_t decoded = 0;
+    while (!bytes.empty()) {
+        size_t eol = bytes.find('\n');
+        std::string_view line = bytes.substr(0, eol);
+        bytes.remove_prefix(eol == std::string_view::npos ? bytes.size() : eol + 1);
+        if (line.empty() || line == "\r") {
+            continue;
+        }
+
+        EdgeView edge;
+        if (!ParseJson(line, edge)) {
+            ++m_malformed;
+            continue;
+        }
+        for (std::string_view s : {edge.from, edge.to, edge.label}) {
+            strings.append(s);
+            m_string_ends.push_back(strings.size());
+        }
+        ++decoded;
+    }
+
+    // Only now that `strings` stopped growing can views into it be handed out.
+    edges.reserve(edges.size() + decoded);
+    size_t begin = 0;
+    std::string_view copies(strings);
+    for (size_t i = 0; i < m_string_ends.size(); i += 3) {
+        EdgeView edge;
+        edge.from = copies.substr(begin, m_string_ends[i] - begin);
+        edge.to = copies.substr(m_string_ends[i], m_string_ends[i + 1] - m_string_ends[i]);
+        edge.label = copies.substr(m_string_ends[i + 1], m_string_ends[i + 2] - m_string_ends[i + 1]);
+        begin = m_string_ends[i + 2];
+        edges.push_back(edge);
+    }
+    return decoded > 0;
+}
+
+/*
+simdjson reads up to SIMDJSON_PADDING bytes past the end of its input, and payloads (librdkafka's buffers, slices of a
+mapped file) aren't padded. Reading past their end is undefined behaviour even where it happens to work, so every
+input is copied into m_padded first. It keeps its capacity between calls, so that is a memcpy, not an allocation.
+*/
+bool EdgeDecoder::ParseJson(std::string_view bytes, EdgeView& edge) {
+    m_padded.reserve(bytes.size() + simdjson::SIMDJSON_PADDING);
+    m_padded.assign(bytes);
+    simdjson::padded_string_view input(m_padded.data(), m_padded.size(), m_padded.capacity());
+
+    simdjson::ondemand::document document;
+    simdjson::ondemand::object object;
+    if (m_parser.iterate(input).get(document) || document.get_object().get(object)) {
+        return false;
+    }
+
+    // Fields are visited in document order, which is the cheapest way through On Demand.
+    bool has_from = false, has_to = false, has_label = false;
+    for (auto field : object) {
+        std::string_view key;
+        if (field.unescaped_key().get(key)) {
+            return false;
+        }
+
+        if (key == "from") {
+            has_from = !field.value().get_string().get(edge.from);
+        } else if (key == "to") {
+            has_to = !field.value().get_string().get(edge.to);
+        } else if (key == "label") {
+            has_label = !field.value().get_string().get(edge.label);
+        }
+    }
+
+    return has_from && has_to && has_label;
+}
+
+bool EdgeDecoder::DecodeEdgeBatch(std::string_view bytes, std::vector<EdgeView>& edges) {
+    graph::EdgeBatch& batch = Take(m_batches, m_batches_used);
+    if (!batch.ParseFromArray(bytes.data(), static_cast<int>(bytes.size()))) {
+        // Nothing points into it, the next payload may have it
+        --m_batches_used;
+        return false;
+    }
+
+    edges.reserve(edges.size() + batch.edges_size());
+    for (const auto& e : batch.edges()) {
+        edges.push_back({e.from(), e.to(), e.label()});
+    }
+    return true;
+}
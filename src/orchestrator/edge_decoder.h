@@ -0,0 +1,61 @@
+#ifndef EDGE_DECODER_H
+#define EDGE_DECODER_H
+
+#include <simdjson.h>
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "graph.grpc.pb.h"
+#include "../payload.h"
+
+/**
+ * An edge as found in an ingest payload. The views point into the decoder that produced them and are only valid
+ * until its next Reset() call.
+ **/
+struct EdgeView {
+    std::string_view from;
+    std::string_view to;
+    std::string_view label;
+};
+
+/**
+ * Decodes ingest payloads into edges without building a DOM.
+ *
+ * JSON payloads go through simdjson's On Demand API, edge batches through protobuf. Several payloads may be decoded
+ * into one group of edges, which stays valid until Reset(). Parser state and buffers are reused between groups, so a
+ * decoder must not be shared between threads. Each ingest shard owns one.
+ **/
+class EdgeDecoder {
+   private:
+    simdjson::ondemand::parser m_parser;
+    std::string m_padded;  // JSON input plus simdjson's padding, see ParseJson()
+    /*
+    One per payload decoded since Reset(), reused by the next group. Copies of the JSON strings (every parse
+    overwrites the parser's own buffer) and the parsed edge batches. Deques, so growing them moves nothing the
+    handed out views point into.
+    */
+    std::deque<std::string> m_strings;
+    size_t m_strings_used = 0;
+    std::deque<graph::EdgeBatch> m_batches;
+    size_t m_batches_used = 0;
+    std::vector<size_t> m_string_ends;
+    size_t m_malformed = 0;
+
+    bool ParseJson(std::string_view bytes, EdgeView& edge);
+    bool DecodeJson(std::string_view bytes, std::vector<EdgeView>& edges);
+    bool DecodeNdjson(std::string_view bytes, std::vector<EdgeView>& edges);
+    bool DecodeEdgeBatch(std::string_view bytes, std::vector<EdgeView>& edges);
+
+   public:
+    // Starts a new group. The edges decoded so far become invalid.
+    void Reset();
+    // Appends the edges of `payload` to `edges`. Returns false if the payload is malformed.
+    bool Decode(const Payload& payload, std::vector<EdgeView>& edges);
+    // Lines of the last NDJSON payload that were skipped because they didn't decode.
+    size_t Malformed() const { return m_malformed; }
+};
+
+#endif
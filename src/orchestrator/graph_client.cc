@@ -6,17 +6,22 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
-#include "../grpc/graph.grpc.pb.h"
+#include "../graph/search_results.h"
+#include "graph.grpc.pb.h"
 #include "../logging/logging.h"
 
 using grpc::Channel;
+using grpc::ClientAsyncResponseReader;
+using grpc::ClientAsyncWriter;
 using grpc::ClientContext;
+using grpc::ClientReader;
 using grpc::ClientWriter;
 using grpc::Status;
 
@@ -27,13 +32,43 @@ using graph::PingRequest;
 using graph::PingResponse;
 using graph::SearchResults;
 
-GraphClient::GraphClient(std::shared_ptr<Channel> channel) : stub_(Graph::NewStub(channel)) {}
+GraphClient::GraphClient(std::shared_ptr<ChannelPool<graph::Graph>> channels) : channels_(channels) {}
 
-void GraphClient::AddVertices(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v) const {
+namespace {
+
+// Every call gets one, so a hung worker fails the call instead of holding up its caller forever
+void SetDeadline(ClientContext& context, std::chrono::seconds timeout) {
+    context.set_deadline(std::chrono::system_clock::now() + timeout);
+}
+
+/*
+Runs a client streaming call prepared on `writer`: starts it, writes `messages` and returns the final status. Stops
+writing once the stream breaks, Finish() tells why.
+*/
+template <typename Message>
+Task<Status> WriteAll(ClientAsyncWriter<Message>& writer, const std::vector<Message>& messages) {
+    if (co_await RpcScheduler::Completes([&](void* tag) { writer.StartCall(tag); })) {
+        for (const auto& message : messages) {
+            if (!co_await RpcScheduler::Completes([&](void* tag) { writer.Write(message, tag); })) {
+                break;
+            }
+        }
+        co_await RpcScheduler::Completes([&](void* tag) { writer.WritesDone(tag); });
+    }
+
+    Status status;
+    co_await RpcScheduler::Completes([&](void* tag) { writer.Finish(&status, tag); });
+    co_return status;
+}
+
+}  // namespace
+
+bool GraphClient::AddVertices(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v) const {
     ClientContext context;
+    SetDeadline(context, kCallTimeout);
     GraphSummary stats;
 
-    std::unique_ptr<ClientWriter<Vertex>> writer(stub_->AddVertex(&context, &stats));
+    std::unique_ptr<ClientWriter<Vertex>> writer(channels_->Next()->AddVertex(&context, &stats));
 
     if (!writer->Write(MakeVertex(v.key_, v.data_))) {
         Logging::ERROR("AddVertex error on write", m_name);
@@ -42,17 +77,19 @@ void GraphClient::AddVertices(const InMemoryGraph<std::string, std::string>::InM
     writer->WritesDone();
     Status status = writer->Finish();
     if (status.ok()) {
-        Logging::INFO("AddVertices finished with " + std::to_string(stats.vertex_count()) + " vertices", m_name);
+        LOG_DEBUG(m_name, "AddVertices finished with {} vertices", stats.vertex_count());
     } else {
         Logging::ERROR("AddVertex rpc failed", m_name);
     }
+    return status.ok();
 }
 
 void GraphClient::DeleteVertex(const std::string& key) const {
     ClientContext context;
+    SetDeadline(context, kCallTimeout);
     GraphSummary stats;
 
-    std::unique_ptr<ClientWriter<Vertex>> writer(stub_->DeleteVertex(&context, &stats));
+    std::unique_ptr<ClientWriter<Vertex>> writer(channels_->Next()->DeleteVertex(&context, &stats));
 
     if (!writer->Write(MakeVertex(key, ""))) {
         Logging::ERROR("DeleteVertex error on write", m_name);
@@ -61,19 +98,20 @@ void GraphClient::DeleteVertex(const std::string& key) const {
     writer->WritesDone();
     Status status = writer->Finish();
     if (status.ok()) {
-        Logging::INFO("DeleteVertex finished with " + std::to_string(stats.vertex_count()) + " vertices", m_name);
+        LOG_DEBUG(m_name, "DeleteVertex finished with {} vertices", stats.vertex_count());
     } else {
         Logging::ERROR("DeleteVertex rpc failed", m_name);
     }
 }
 
-void GraphClient::AddEdges(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v,
+bool GraphClient::AddEdges(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v,
                            const InMemoryGraph<std::string, std::string>::InMemoryEdge& e,
                            const std::string& lookup_from) const {
     ClientContext context;
+    SetDeadline(context, kCallTimeout);
     GraphSummary stats;
 
-    std::unique_ptr<ClientWriter<Edge>> writer(stub_->AddEdge(&context, &stats));
+    std::unique_ptr<ClientWriter<Edge>> writer(channels_->Next()->AddEdge(&context, &stats));
 
     if (!writer->Write(MakeEdge(v.key_, e.to_, e.data_, lookup_from, e.lookup_to_))) {
         Logging::ERROR("AddEdges error on write", m_name);
@@ -82,17 +120,44 @@ void GraphClient::AddEdges(const InMemoryGraph<std::string, std::string>::InMemo
     writer->WritesDone();
     Status status = writer->Finish();
     if (status.ok()) {
-        Logging::INFO("AddEdge finished with " + std::to_string(stats.edge_count()) + " edges", m_name);
+        LOG_DEBUG(m_name, "AddEdge finished with {} edges", stats.edge_count());
     } else {
         Logging::ERROR("AddEdge rpc failed", m_name);
     }
+    return status.ok();
+}
+
+bool GraphClient::UpsertEdges(const std::vector<Edge>& edges) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+
+    std::unique_ptr<ClientWriter<Edge>> writer(channels_->Next()->UpsertEdges(&context, &stats));
+
+    for (const auto& edge : edges) {
+        if (!writer->Write(edge)) {
+            // Stream is broken, Finish() below tells why
+            LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "UpsertEdges error on write");
+            break;
+        }
+    }
+
+    writer->WritesDone();
+    Status status = writer->Finish();
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "UpsertEdges finished with {} edges", stats.edge_count());
+    } else {
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "UpsertEdges rpc failed: {}", status.error_message());
+    }
+    return status.ok();
 }
 
 void GraphClient::DeleteEdge(const std::string& from, const std::string& to) const {
     ClientContext context;
+    SetDeadline(context, kCallTimeout);
     GraphSummary stats;
 
-    std::unique_ptr<ClientWriter<Edge>> writer(stub_->DeleteEdge(&context, &stats));
+    std::unique_ptr<ClientWriter<Edge>> writer(channels_->Next()->DeleteEdge(&context, &stats));
 
     if (!writer->Write(MakeEdge(from, to, "", "", ""))) {
         Logging::ERROR("DeleteEdge error on write", m_name);
@@ -101,45 +166,35 @@ void GraphClient::DeleteEdge(const std::string& from, const std::string& to) con
     writer->WritesDone();
     Status status = writer->Finish();
     if (status.ok()) {
-        Logging::INFO("DeleteEdge finished with " + std::to_string(stats.edge_count()) + " edges", m_name);
+        LOG_DEBUG(m_name, "DeleteEdge finished with {} edges", stats.edge_count());
     } else {
         Logging::ERROR("DeleteEdge rpc failed", m_name);
     }
 }
 
-Status GraphClient::Search(const std::string& key, const int max_level, SearchResults& result) const {
+Status GraphClient::Search(const std::string& key, const int max_level, bool undirected,
+                           SearchResults& result) const {
     ClientContext context;
-    SearchArgs args = MakeSearchArgs(key, max_level);
-    Status status = stub_->Search(&context, args, &result);
+    SetDeadline(context, kCallTimeout);
+    SearchArgs args = MakeSearchArgs(key, max_level, undirected);
+    Status status = channels_->Next()->Search(&context, args, &result);
+    CheckSearchResults(result, status);
     if (!status.ok()) {
         Logging::ERROR("Search rpc failed", m_name);
     } else {
-        std::stringstream s;
-        s << "Finished with " << result.vertices().size() << " vertices:[";
-        std::string sep;
-        for (auto& v : result.vertices()) {
-            s << sep << v.key();
-            sep.assign(", ");
-        }
-        s << "] and " << result.edges().size() << " edges: [";
-        sep.assign("");
-        for (auto& e : result.edges()) {
-            s << sep << e.label();
-            sep.assign(", ");
-        }
-        s << "]";
-        Logging::INFO(s.str(), m_name);
+        LogSearchResults(result);
     }
     return status;
 }
 
 void GraphClient::AddHost(const std::string& key, const std::string& address) const {
     ClientContext context;
+    SetDeadline(context, kCallTimeout);
     Host host;
     host.set_key(key);
     host.set_address(address);
     ::google::protobuf::Empty result;
-    Status status = stub_->AddHost(&context, host, &result);
+    Status status = channels_->Next()->AddHost(&context, host, &result);
     if (status.ok()) {
         Logging::INFO("AddHost finished", m_name);
     } else {
@@ -147,13 +202,32 @@ void GraphClient::AddHost(const std::string& key, const std::string& address) co
     }
 }
 
+bool GraphClient::ListVertices(const std::function<void(const Vertex&)>& on_vertex) const {
+    ClientContext context;
+    SetDeadline(context, kListTimeout);
+    ::google::protobuf::Empty request;
+    Vertex vertex;
+
+    std::unique_ptr<ClientReader<Vertex>> reader(channels_->Next()->ListVertices(&context, request));
+    while (reader->Read(&vertex)) {
+        on_vertex(vertex);
+    }
+
+    Status status = reader->Finish();
+    if (!status.ok()) {
+        Logging::ERROR("ListVertices rpc failed", m_name);
+    }
+    return status.ok();
+}
+
 bool GraphClient::Ping() const {
     ClientContext context;
+    SetDeadline(context, kPingTimeout);
     PingRequest ping;
     ping.set_data("hello");
 
     PingResponse response;
-    Status status = stub_->Ping(&context, ping, &response);
+    Status status = channels_->Next()->Ping(&context, ping, &response);
     if (status.ok()) {
         // Logging::INFO("Ping ok response: '" + response.data() + "'", m_name);
         return true;
@@ -163,6 +237,170 @@ bool GraphClient::Ping() const {
     }
 }
 
+Task<bool> GraphClient::AddVerticesAsync(InMemoryGraph<std::string, std::string>::InMemoryVertex v,
+                                         RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+    std::vector<Vertex> vertices{MakeVertex(v.key_, v.data_)};
+
+    std::unique_ptr<ClientAsyncWriter<Vertex>> writer(
+        channels_->Next()->PrepareAsyncAddVertex(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, vertices);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "AddVertices finished with {} vertices", stats.vertex_count());
+    } else {
+        Logging::ERROR("AddVertex rpc failed", m_name);
+    }
+    co_return status.ok();
+}
+
+Task<bool> GraphClient::AddEdgesAsync(InMemoryGraph<std::string, std::string>::InMemoryVertex v,
+                                      InMemoryGraph<std::string, std::string>::InMemoryEdge e, std::string lookup_from,
+                                      RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+    std::vector<Edge> edges{MakeEdge(v.key_, e.to_, e.data_, lookup_from, e.lookup_to_)};
+
+    std::unique_ptr<ClientAsyncWriter<Edge>> writer(
+        channels_->Next()->PrepareAsyncAddEdge(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, edges);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "AddEdge finished with {} edges", stats.edge_count());
+    } else {
+        Logging::ERROR("AddEdge rpc failed", m_name);
+    }
+    co_return status.ok();
+}
+
+Task<bool> GraphClient::UpsertEdgesAsync(const std::vector<Edge>& edges, RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+
+    std::unique_ptr<ClientAsyncWriter<Edge>> writer(
+        channels_->Next()->PrepareAsyncUpsertEdges(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, edges);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "UpsertEdges finished with {} edges", stats.edge_count());
+    } else {
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "UpsertEdges rpc failed: {}", status.error_message());
+    }
+    co_return status.ok();
+}
+
+Task<bool> GraphClient::AddVerticesAsync(const std::vector<Vertex>& vertices, RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+
+    std::unique_ptr<ClientAsyncWriter<Vertex>> writer(
+        channels_->Next()->PrepareAsyncAddVertex(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, vertices);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "AddVertex finished with {} vertices", stats.vertex_count());
+    } else {
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "AddVertex rpc failed: {}", status.error_message());
+    }
+    co_return status.ok();
+}
+
+Task<bool> GraphClient::DeleteVerticesAsync(const std::vector<Vertex>& vertices, RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+
+    std::unique_ptr<ClientAsyncWriter<Vertex>> writer(
+        channels_->Next()->PrepareAsyncDeleteVertex(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, vertices);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "DeleteVertex finished with {} vertices", stats.vertex_count());
+    } else {
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "DeleteVertex rpc failed: {}", status.error_message());
+    }
+    co_return status.ok();
+}
+
+Task<bool> GraphClient::DeleteEdgesAsync(const std::vector<Edge>& edges, RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    GraphSummary stats;
+
+    std::unique_ptr<ClientAsyncWriter<Edge>> writer(
+        channels_->Next()->PrepareAsyncDeleteEdge(&context, &stats, scheduler.Queue()));
+    Status status = co_await WriteAll(*writer, edges);
+    if (status.ok()) {
+        LOG_DEBUG(m_name, "DeleteEdge finished with {} edges", stats.edge_count());
+    } else {
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "DeleteEdge rpc failed: {}", status.error_message());
+    }
+    co_return status.ok();
+}
+
+Task<Status> GraphClient::SearchAsync(std::string key, const int max_level, bool undirected, SearchResults& result,
+                                      RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kCallTimeout);
+    SearchArgs args = MakeSearchArgs(key, max_level, undirected);
+    Status status;
+
+    std::unique_ptr<ClientAsyncResponseReader<SearchResults>> reader(
+        channels_->Next()->PrepareAsyncSearch(&context, args, scheduler.Queue()));
+    reader->StartCall();
+    co_await RpcScheduler::Completes([&](void* tag) { reader->Finish(&result, &status, tag); });
+    CheckSearchResults(result, status);
+    if (!status.ok()) {
+        Logging::ERROR("Search rpc failed", m_name);
+    } else {
+        LogSearchResults(result);
+    }
+    co_return status;
+}
+
+Task<std::optional<std::string>> GraphClient::PingAsync(RpcScheduler& scheduler) const {
+    ClientContext context;
+    SetDeadline(context, kPingTimeout);
+    PingRequest ping;
+    ping.set_data("hello");
+
+    PingResponse response;
+    Status status;
+    std::unique_ptr<ClientAsyncResponseReader<PingResponse>> reader(
+        channels_->Next()->PrepareAsyncPing(&context, ping, scheduler.Queue()));
+    reader->StartCall();
+    co_await RpcScheduler::Completes([&](void* tag) { reader->Finish(&response, &status, tag); });
+    if (!status.ok()) {
+        co_return std::nullopt;
+    }
+    co_return response.instance();
+}
+
+void GraphClient::CheckSearchResults(SearchResults& result, Status& status) const {
+    if (status.ok() && !graph::IsValid(result)) {
+        result.Clear();
+        status = Status(grpc::StatusCode::DATA_LOSS, "Malformed search results");
+    }
+}
+
+void GraphClient::LogSearchResults(const SearchResults& result) const {
+    std::stringstream s;
+    s << "Finished with " << result.vertices().size() << " vertices:[";
+    std::string sep;
+    for (uint32_t v : result.vertices()) {
+        s << sep << result.keys(v);
+        sep.assign(", ");
+    }
+    s << "] and " << result.edges().size() << " edges: [";
+    sep.assign("");
+    for (auto& e : result.edges()) {
+        s << sep << result.labels(e.label());
+        sep.assign(", ");
+    }
+    s << "]";
+    Logging::INFO(s.str(), m_name);
+}
+
 Vertex GraphClient::MakeVertex(std::string key, std::string value) const {
     graph::Vertex v;
     v.set_key(key);
@@ -170,10 +408,11 @@ Vertex GraphClient::MakeVertex(std::string key, std::string value) const {
     return v;
 }
 
-SearchArgs GraphClient::MakeSearchArgs(std::string key, const int max_level) const {
+SearchArgs GraphClient::MakeSearchArgs(std::string key, const int max_level, bool undirected) const {
     graph::SearchArgs a;
     a.set_start_key(key);
     a.set_level(max_level);
+    a.set_undirected(undirected);
     return a;
 }
 
@@ -1,10 +1,18 @@
 #ifndef GRAPH_CLIENT_H
 #define GRAPH_CLIENT_H
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include "../channel_pool.h"
 #include "../graph/in_memory_graph.h"
-#include "../grpc/graph.grpc.pb.h"
+#include "graph.grpc.pb.h"
+#include "../rpc_scheduler.h"
+#include "../task.h"
 
 using graph::Edge;
 using graph::SearchArgs;
@@ -14,33 +22,80 @@ using grpc::Status;
 
 class GraphClient {
    public:
-    GraphClient(std::shared_ptr<Channel> channel);
+    // Deadlines of the calls to the worker. Listing streams the worker's whole graph.
+    static constexpr std::chrono::seconds kCallTimeout{30};
+    static constexpr std::chrono::seconds kPingTimeout{2};
+    static constexpr std::chrono::seconds kListTimeout{300};
 
-    void AddVertices(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v) const;
+    // Calls go round robin over the pool's channels
+    GraphClient(std::shared_ptr<ChannelPool<graph::Graph>> channels);
+
+    // Write methods return whether the worker acknowledged the write.
+    bool AddVertices(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v) const;
 
     void DeleteVertex(const std::string& key) const;
 
-    void AddEdges(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v,
+    bool AddEdges(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v,
                   const InMemoryGraph<std::string, std::string>::InMemoryEdge& e, const std::string& lookup_from) const;
 
     void DeleteEdge(const std::string& from, const std::string& to) const;
 
-    Status Search(const std::string& key, const int max_level, SearchResults& result) const;
+    // Streams all edges in one call. The worker creates missing endpoints it owns.
+    bool UpsertEdges(const std::vector<Edge>& edges) const;
+
+    // `undirected`: whether edges are stored as both halves, see graph::EdgeKey()
+    Status Search(const std::string& key, const int max_level, bool undirected, SearchResults& result) const;
 
     void AddHost(const std::string& key, const std::string& address) const;
 
+    // Calls `on_vertex` for every vertex of the worker. Only keys are filled in.
+    bool ListVertices(const std::function<void(const Vertex&)>& on_vertex) const;
+
     bool Ping() const;
 
+    /*
+    Awaitable versions of the calls above. They don't block a thread while the call is in flight and complete on one
+    of `scheduler`'s threads. The client, the scheduler and anything passed by reference must outlive the task.
+    */
+    Task<bool> AddVerticesAsync(InMemoryGraph<std::string, std::string>::InMemoryVertex v,
+                                RpcScheduler& scheduler) const;
+
+    Task<bool> AddEdgesAsync(InMemoryGraph<std::string, std::string>::InMemoryVertex v,
+                             InMemoryGraph<std::string, std::string>::InMemoryEdge e, std::string lookup_from,
+                             RpcScheduler& scheduler) const;
+
+    Task<bool> UpsertEdgesAsync(const std::vector<Edge>& edges, RpcScheduler& scheduler) const;
+
+    // Whole batches in one stream each, for the user facing API
+    Task<bool> AddVerticesAsync(const std::vector<Vertex>& vertices, RpcScheduler& scheduler) const;
+
+    Task<bool> DeleteVerticesAsync(const std::vector<Vertex>& vertices, RpcScheduler& scheduler) const;
+
+    Task<bool> DeleteEdgesAsync(const std::vector<Edge>& edges, RpcScheduler& scheduler) const;
+
+    Task<Status> SearchAsync(std::string key, const int max_level, bool undirected, SearchResults& result,
+                             RpcScheduler& scheduler) const;
+
+    // The worker's instance (see PingResponse), nothing if it didn't answer
+    Task<std::optional<std::string>> PingAsync(RpcScheduler& scheduler) const;
+
+    ChannelPool<graph::Graph>& Channels() const { return *channels_; }
+
    private:
     Vertex MakeVertex(std::string key, std::string value) const;
 
-    SearchArgs MakeSearchArgs(std::string key, const int max_level) const;
+    SearchArgs MakeSearchArgs(std::string key, const int max_level, bool undirected) const;
 
     Edge MakeEdge(const std::string& from, const std::string& to, const std::string& label,
                   const std::string& lookup_from, const std::string& lookup_to) const;
 
+    // Turns a response whose indices are out of its tables into an error, see graph::IsValid()
+    void CheckSearchResults(SearchResults& result, Status& status) const;
+
+    void LogSearchResults(const SearchResults& result) const;
+
    private:
-    std::unique_ptr<graph::Graph::Stub> stub_;
+    std::shared_ptr<ChannelPool<graph::Graph>> channels_;
     std::string m_name = "GraphClient";
 };
 
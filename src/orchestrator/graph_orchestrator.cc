@@ -6,19 +6,23 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <algorithm>
 #include <functional>  //for std::hash
+#include <future>
 #include <iostream>
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <random>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "../graph/helper.h"
 #include "../graph/in_memory_graph.h"
-#include "../grpc/graph.grpc.pb.h"
+#include "../graph/search_results.h"
+#include "graph.grpc.pb.h"
 #include "../logging/logging.h"
 #include "graph_client.h"
+#include "write_pipeline.h"
 using graph::Edge;
 using graph::Graph;
 using graph::Host;
@@ -28,17 +32,23 @@ using grpc::Channel;
 
 GraphOrchestrator::GraphOrchestrator(std::string name_) : m_name(name_) {}
 
-void GraphOrchestrator::AddVertex(std::string key, std::string data) {
+bool GraphOrchestrator::AddVertex(std::string key, std::string data) {
     std::hash<std::string> hasher;
     auto hashed = hasher(key);
     int worker_index = hashed % m_worker_clients.size();
-    Logging::DEBUG("Pushing vertex '" + key + "' to worker '" + m_worker_address[worker_index] + "'", m_name);
-    m_worker_clients[worker_index].AddVertices(InMemoryGraph<std::string, std::string>::InMemoryVertex(key, data));
+    LOG_DEBUG(m_name, "Pushing vertex '{}' to worker '{}'", key, m_worker_address[worker_index]);
+    return m_worker_clients[worker_index].AddVertices(
+        InMemoryGraph<std::string, std::string>::InMemoryVertex(key, data));
+}
+
+size_t GraphOrchestrator::WorkerFor(const std::string& key) const {
+    std::hash<std::string> hasher;
+    return hasher(key) % m_worker_clients.size();
 }
 
 // void GraphClient::AddEdges(const InMemoryGraph<std::string, std::string>::InMemoryVertex& v, const
 // InMemoryGraph<std::string, std::string>::InMemoryEdge& e, const std::string& lookup_from)
-void GraphOrchestrator::AddEdge(std::string from, std::string to, std::string label) {
+bool GraphOrchestrator::AddEdge(std::string from, std::string to, std::string label) {
     std::hash<std::string> hasher;
     auto from_worker_hashed = hasher(from);
     int from_worker_index = from_worker_hashed % m_worker_clients.size();
@@ -46,20 +56,119 @@ void GraphOrchestrator::AddEdge(std::string from, std::string to, std::string la
     auto lookup_to_worker_hashed = hasher(to);
     int lookup_to_worker_index = lookup_to_worker_hashed % m_worker_clients.size();
 
-    Logging::INFO("Push edge [" + from + "][" + label + "][" + to + "] to worker '" +
-                      std::to_string(from_worker_index) + "' with lookup_to: '" +
-                      std::to_string(lookup_to_worker_index) + "' (" + m_worker_address[lookup_to_worker_index] + ")",
-                  m_name);
+    LOG_DEBUG(m_name, "Push edge [{}][{}][{}] to worker '{}' with lookup_to: '{}' ({})", from, label, to,
+              from_worker_index, lookup_to_worker_index, m_worker_address[lookup_to_worker_index]);
 
     InMemoryGraph<std::string, std::string>::InMemoryVertex from_vertex(from, from);
     InMemoryGraph<std::string, std::string>::InMemoryEdge edge(to, label, m_worker_address[lookup_to_worker_index]);
 
-    m_worker_clients[from_worker_index].AddEdges(from_vertex, edge, m_worker_address[from_worker_index]);
+    return m_worker_clients[from_worker_index].AddEdges(from_vertex, edge, m_worker_address[from_worker_index]);
+}
+
+/*
+Calls `emit_edge(worker, edge)` for every write the edge from->to takes. Undirected edges are written as two halves,
+from->to on the worker owning `from` and to->from on the worker owning `to`, so a search finds the edge from either
+end. Each half is an upsert creating its own source, no extra vertex writes needed.
+
+In directed mode a target living on another worker needs a vertex of its own there: `emit_vertex(worker, vertex)`,
+unless the cache knows it (there is only a cache in directed mode). Its data is the key itself. Callers write those along with the edges, not ahead of them.
+*/
+template <typename EmitEdge, typename EmitVertex>
+void GraphOrchestrator::RouteEdge(std::string from, std::string to, std::string label, EmitEdge&& emit_edge,
+                                  EmitVertex&& emit_vertex) {
+    size_t from_worker = WorkerFor(from);
+    size_t to_worker = WorkerFor(to);
+
+    if (m_undirected) {
+        Edge reverse;
+        reverse.set_from(to);
+        reverse.set_to(from);
+        reverse.set_label(label);
+        reverse.set_lookup_from(m_worker_address[to_worker]);
+        reverse.set_lookup_to(m_worker_address[from_worker]);
+        emit_edge(to_worker, std::move(reverse));
+    } else if (to_worker != from_worker && !(m_known_vertices && m_known_vertices->Contains(to, to_worker))) {
+        Vertex target;
+        target.set_key(to);
+        target.set_value(to);
+        emit_vertex(to_worker, std::move(target));
+    }
+
+    Edge e;
+    e.set_from(std::move(from));
+    e.set_to(std::move(to));
+    e.set_label(std::move(label));
+    e.set_lookup_from(m_worker_address[from_worker]);
+    e.set_lookup_to(m_worker_address[to_worker]);
+    emit_edge(from_worker, std::move(e));
+}
+
+/*
+Upserts `edges` on the worker, then remembers their sources as known. A failed write may have left the worker with
+only part of them, or the worker may be gone, so the cache forgets everything it knew about that worker.
+*/
+Task<bool> GraphOrchestrator::UpsertEdgesTo(size_t worker, const std::vector<Edge>& edges) {
+    uint64_t epoch = m_known_vertices ? m_known_vertices->Epoch(worker) : 0;
+    bool ok = co_await m_worker_clients[worker].UpsertEdgesAsync(edges, *m_rpc_scheduler);
+    if (m_known_vertices && !ok) {
+        m_known_vertices->Invalidate(worker);
+    } else if (m_known_vertices) {
+        for (const auto& e : edges) {
+            m_known_vertices->Insert(e.from(), worker, epoch);
+        }
+    }
+    co_return ok;
+}
+
+// Same as UpsertEdgesTo()
+Task<bool> GraphOrchestrator::AddVerticesTo(size_t worker, const std::vector<Vertex>& vertices) {
+    uint64_t epoch = m_known_vertices ? m_known_vertices->Epoch(worker) : 0;
+    bool ok = co_await m_worker_clients[worker].AddVerticesAsync(vertices, *m_rpc_scheduler);
+    if (m_known_vertices && !ok) {
+        m_known_vertices->Invalidate(worker);
+    } else if (m_known_vertices) {
+        for (const auto& v : vertices) {
+            m_known_vertices->Insert(v.key(), worker, epoch);
+        }
+    }
+    co_return ok;
+}
+
+// Forgets the vertices even if the call failed, part of them may be gone anyway
+Task<bool> GraphOrchestrator::DeleteVerticesFrom(size_t worker, const std::vector<Vertex>& vertices) {
+    bool ok = co_await m_worker_clients[worker].DeleteVerticesAsync(vertices, *m_rpc_scheduler);
+    if (m_known_vertices) {
+        for (const auto& v : vertices) {
+            m_known_vertices->Erase(v.key());
+        }
+    }
+    co_return ok;
 }
 
 bool GraphOrchestrator::Healthy() { return m_healthy.load(); }
 
 void GraphOrchestrator::Init() {
+    /*************************************************************************
+     *
+     * CONNECT
+     *
+     *************************************************************************/
+    /*
+    Open every connection now, all at once, so the first writes and queries don't wait for handshakes. Workers that
+    aren't up yet are connected to on first use as usual.
+    */
+    for (const auto& worker : m_worker_clients) {
+        worker.Channels().Connect();
+    }
+    auto deadline = std::chrono::system_clock::now() + kConnectTimeout;
+    for (size_t i = 0; i < m_worker_clients.size(); ++i) {
+        ChannelPool<graph::Graph>& channels = m_worker_clients[i].Channels();
+        size_t connected = channels.WaitForConnected(deadline);
+        Logging::INFO("Connected " + std::to_string(connected) + " of " + std::to_string(channels.Size()) +
+                          " channels to '" + m_worker_address[i] + "'",
+                      m_name);
+    }
+
     /*************************************************************************
      *
      * ADVERTISE HOSTS
@@ -70,53 +179,98 @@ void GraphOrchestrator::Init() {
             worker.AddHost(address, address);
         }
     }
+
+    /*************************************************************************
+     *
+     * SEED KNOWN VERTICES
+     *
+     *************************************************************************/
+    if (m_known_vertices) {
+        for (size_t i = 0; i < m_worker_clients.size(); ++i) {
+            uint64_t epoch = m_known_vertices->Epoch(i);
+            m_worker_clients[i].ListVertices(
+                [this, i, epoch](const Vertex& v) { m_known_vertices->Insert(v.key(), i, epoch); });
+        }
+        Logging::INFO("Seeded vertex cache with " + std::to_string(m_known_vertices->Size()) + " vertices", m_name);
+    }
 }
 
-void GraphOrchestrator::Query() {
-    std::shared_ptr<std::string> payload = m_input_queue->Pop();
-    if (payload) {
-        Logging::INFO("Got " + *payload, m_name);
-        while (!Healthy()) {
-            Logging::ERROR("Graph doesn't seem to be healthy. Not attemping to add node", m_name);
+/*
+Called concurrently by the ingest shards. Worker clients are only read here and gRPC stubs are thread safe.
+
+Edges are grouped by the worker owning their source (see RouteEdge) and sent as one UpsertEdges stream per worker.
+The worker creates the source (and the target, if it owns it too) along with the edge, so no AddVertex has to go
+ahead of it. Directed edges to targets on other workers the cache doesn't know yet are the exception: those targets
+are collected per worker and sent as one AddVertex stream each, alongside the edge streams.
+
+The per-worker streams run concurrently, so the second half costs no extra round trip, and no thread waits for them:
+the task completes on the RPC scheduler's thread that finished the last one.
+
+Returns true only once every write has been acknowledged by its worker. On false the caller retries the whole batch
+later; the writes are idempotent so the part that did go through is simply applied again.
+*/
+Task<bool> GraphOrchestrator::Apply(const std::vector<EdgeView>& edges) {
+    if (!Healthy()) {
+        // Shards retry until the workers are back, this fires on every attempt
+        LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name,
+                     "Graph doesn't seem to be healthy. Not attemping to add node");
+        co_return false;
+    }
+
+    std::vector<std::vector<Edge>> by_worker(m_worker_clients.size());
+    std::vector<std::vector<Vertex>> targets_by_worker(m_worker_clients.size());
+    std::unordered_set<std::string> targets;  // once per batch, however many edges point there
+    auto add_edge = [&by_worker](size_t worker, Edge&& e) { by_worker[worker].push_back(std::move(e)); };
+    auto add_target = [&targets_by_worker, &targets](size_t worker, Vertex&& v) {
+        if (targets.insert(v.key()).second) {
+            targets_by_worker[worker].push_back(std::move(v));
         }
+    };
+    for (const auto& edge : edges) {
+        RouteEdge(std::string(edge.from), std::string(edge.to), std::string(edge.label), add_edge, add_target);
+    }
 
-        /*
-        {"from": "a","to": "b","label": "friend"}
-        */
-        using json = nlohmann::json;
-        try {
-            json data = json::parse(*payload);
-            std::string from = data.at("from");
-            std::string to = data.at("to");
-            std::string label = data.at("label");
-
-            AddVertex(from, from);
-            AddVertex(to, to);
-            AddEdge(from, to, label);
-        } catch (...) {
-            Logging::ERROR("Malformed payload: '" + *payload + "'", m_name);
+    // All streams are in flight at once, driven by the RPC scheduler
+    std::vector<Task<bool>> writes;
+    for (size_t i = 0; i < m_worker_clients.size(); ++i) {
+        if (!by_worker[i].empty()) {
+            writes.emplace_back(UpsertEdgesTo(i, by_worker[i]));
+        }
+        if (!targets_by_worker[i].empty()) {
+            writes.emplace_back(AddVerticesTo(i, targets_by_worker[i]));
         }
     }
+    std::vector<bool> written = co_await WhenAll(std::move(writes));
+    co_return std::all_of(written.begin(), written.end(), [](bool w) { return w; });
 }
 
-void GraphOrchestrator::Stop() { Logging::INFO("Stopping", m_name); }
-
-void GraphOrchestrator::Ping() {
+Task<void> GraphOrchestrator::Ping() {
     // Not thread safe!
 
-    bool ok = true;
+    std::vector<Task<std::optional<std::string>>> pings;
     for (const auto& worker : m_worker_clients) {
-        ok = worker.Ping();
-        if (!ok) {
-            break;
-        }
+        pings.emplace_back(worker.PingAsync(*m_rpc_scheduler));
     }
+    std::vector<std::optional<std::string>> instances = co_await WhenAll(std::move(pings));
 
-    if (ok) {
-        m_healthy.store(true);
-    } else {
-        m_healthy.store(false);
+    /*
+    A worker that went away, or restarted between two pings (its instance changed), may be back with an empty graph.
+    Don't trust anything we knew about it before.
+    */
+    m_worker_instances.resize(m_worker_clients.size());
+    bool ok = true;
+    for (size_t i = 0; i < instances.size(); ++i) {
+        bool restarted = instances[i] && !m_worker_instances[i].empty() && *instances[i] != m_worker_instances[i];
+        if ((!instances[i] || restarted) && m_known_vertices) {
+            m_known_vertices->Invalidate(i);
+        }
+        if (restarted) {
+            Logging::WARN("Worker '" + m_worker_address[i] + "' restarted, forgot its known vertices", m_name);
+        }
+        ok = ok && instances[i].has_value();
+        m_worker_instances[i] = instances[i].value_or("");
     }
+    m_healthy.store(ok);
 }
 
 /*
@@ -127,7 +281,9 @@ void GraphOrchestrator::Ping() {
 
 Status GraphOrchestrator::Search(std::string query_key, int level, std::vector<std::string>& vertices,
                                  std::vector<std::string>& edges) {
-    SearchResults result;
+    // Big results are thousands of small messages, one arena spares allocating and freeing them one by one
+    google::protobuf::Arena arena(graph::SearchArenaOptions());
+    SearchResults& result = *google::protobuf::Arena::CreateMessage<SearchResults>(&arena);
 
     std::hash<std::string> hasher;
     auto hashed = hasher(query_key);
@@ -135,19 +291,140 @@ Status GraphOrchestrator::Search(std::string query_key, int level, std::vector<s
     Logging::INFO("Start search vertex '" + query_key + "' with at: '" + std::to_string(worker_index) + "' (" +
                       m_worker_address[worker_index] + ")",
                   m_name);
-    Status status = m_worker_clients[worker_index].Search(query_key, level, result);
+    Status status = m_worker_clients[worker_index].Search(query_key, level, m_undirected, result);
 
     if (!status.ok()) {
         Logging::ERROR("Search rpc failed", m_name);
     } else {
-        for (auto& v : result.vertices()) {
-            vertices.emplace_back(v.key());
+        vertices.reserve(vertices.size() + result.vertices_size());
+        for (uint32_t v : result.vertices()) {
+            vertices.emplace_back(result.keys(v));
         }
 
+        edges.reserve(edges.size() + result.edges_size());
         for (auto& e : result.edges()) {
-            edges.emplace_back(e.label());
+            edges.emplace_back(result.labels(e.label()));
         }
     }
 
     return status;
-}
\ No newline at end of file
+}
+
+namespace {
+
+Status Unhealthy() { return Status(grpc::StatusCode::UNAVAILABLE, "Graph is not healthy"); }
+
+Status Written(bool ok, size_t count, const char* what) {
+    if (ok) {
+        return Status::OK;
+    }
+    return Status(grpc::StatusCode::UNAVAILABLE,
+                  "Not all of the " + std::to_string(count) + " " + what + " were acknowledged by the workers");
+}
+
+}  // namespace
+
+Status GraphOrchestrator::AddVertices(const std::function<bool(orchestrator::ApiVertex&)>& read, size_t& count) {
+    count = 0;
+    if (!Healthy()) {
+        return Unhealthy();
+    }
+
+    WritePipeline<Vertex> pipeline(m_worker_clients.size(), kApiBatchSize,
+                                   [this](size_t worker, const std::vector<Vertex>& batch) {
+                                       return AddVerticesTo(worker, batch);
+                                   });
+    orchestrator::ApiVertex item;
+    while (!pipeline.Failed() && read(item)) {
+        Vertex v;
+        v.set_key(std::move(*item.mutable_key()));
+        v.set_value(std::move(*item.mutable_value()));
+        size_t worker = WorkerFor(v.key());
+        pipeline.Add(worker, std::move(v));
+        ++count;
+    }
+    return Written(pipeline.Finish(), count, "vertices");
+}
+
+Status GraphOrchestrator::DeleteVertices(const std::function<bool(orchestrator::ApiVertex&)>& read, size_t& count) {
+    count = 0;
+    if (!Healthy()) {
+        return Unhealthy();
+    }
+
+    WritePipeline<Vertex> pipeline(m_worker_clients.size(), kApiBatchSize,
+                                   [this](size_t worker, const std::vector<Vertex>& batch) {
+                                       return DeleteVerticesFrom(worker, batch);
+                                   });
+    orchestrator::ApiVertex item;
+    while (!pipeline.Failed() && read(item)) {
+        Vertex v;
+        v.set_key(std::move(*item.mutable_key()));
+        size_t worker = WorkerFor(v.key());
+        pipeline.Add(worker, std::move(v));
+        ++count;
+    }
+    return Written(pipeline.Finish(), count, "vertices");
+}
+
+// The same writes as ingest does, see Apply()
+Status GraphOrchestrator::AddEdges(const std::function<bool(orchestrator::ApiEdge&)>& read, size_t& count) {
+    count = 0;
+    if (!Healthy()) {
+        return Unhealthy();
+    }
+
+    WritePipeline<Edge> pipeline(m_worker_clients.size(), kApiBatchSize,
+                                 [this](size_t worker, const std::vector<Edge>& batch) {
+                                     return UpsertEdgesTo(worker, batch);
+                                 });
+    WritePipeline<Vertex> target_pipeline(m_worker_clients.size(), kApiBatchSize,
+                                          [this](size_t worker, const std::vector<Vertex>& batch) {
+                                              return AddVerticesTo(worker, batch);
+                                          });
+    std::unordered_set<std::string> targets;  // once per stream, however many edges point there
+    auto add_edge = [&pipeline](size_t worker, Edge&& e) { pipeline.Add(worker, std::move(e)); };
+    auto add_target = [&target_pipeline, &targets](size_t worker, Vertex&& v) {
+        if (targets.insert(v.key()).second) {
+            target_pipeline.Add(worker, std::move(v));
+        }
+    };
+    orchestrator::ApiEdge item;
+    while (!pipeline.Failed() && !target_pipeline.Failed() && read(item)) {
+        RouteEdge(std::move(*item.mutable_from()), std::move(*item.mutable_to()), std::move(*item.mutable_label()),
+                  add_edge, add_target);
+        ++count;
+    }
+    bool edges_written = pipeline.Finish();
+    bool targets_written = target_pipeline.Finish();
+    return Written(edges_written && targets_written, count, "edges");
+}
+
+// Deletes both halves of undirected edges, with every label
+Status GraphOrchestrator::DeleteEdges(const std::function<bool(orchestrator::ApiEdge&)>& read, size_t& count) {
+    count = 0;
+    if (!Healthy()) {
+        return Unhealthy();
+    }
+
+    WritePipeline<Edge> pipeline(m_worker_clients.size(), kApiBatchSize,
+                                 [this](size_t worker, const std::vector<Edge>& batch) {
+                                     return m_worker_clients[worker].DeleteEdgesAsync(batch, *m_rpc_scheduler);
+                                 });
+    orchestrator::ApiEdge item;
+    while (!pipeline.Failed() && read(item)) {
+        if (m_undirected) {
+            Edge reverse;
+            reverse.set_from(item.to());
+            reverse.set_to(item.from());
+            pipeline.Add(WorkerFor(item.to()), std::move(reverse));
+        }
+        Edge e;
+        e.set_from(std::move(*item.mutable_from()));
+        e.set_to(std::move(*item.mutable_to()));
+        size_t worker = WorkerFor(e.from());
+        pipeline.Add(worker, std::move(e));
+        ++count;
+    }
+    return Written(pipeline.Finish(), count, "edges");
+}
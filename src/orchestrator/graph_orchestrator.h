@@ -2,38 +2,66 @@
 #define GRAPH_ORCHESTRATOR_H
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "../data_source.h"
-#include "../lock_free_queue.h"
+#include "orchestrator.pb.h"
+#include "../rpc_scheduler.h"
+#include "../task.h"
+#include "edge_decoder.h"
 #include "graph_client.h"
+#include "known_vertex_cache.h"
 
 class OrchestratorBuilder;
 
-class GraphOrchestrator : public DataSource {
+class GraphOrchestrator {
    private:
     std::string m_name;
     std::vector<GraphClient> m_worker_clients;
     std::vector<std::string> m_worker_address;
     std::shared_ptr<std::atomic<size_t>> m_active_processors;
-    std::shared_ptr<LockFreeQueue<std::string>> m_input_queue;
     std::atomic<bool> m_healthy;
+    std::unique_ptr<KnownVertexCache> m_known_vertices;  // directed mode only
+    std::vector<std::string> m_worker_instances;         // as of the last Ping(), empty if it didn't answer
+    bool m_undirected = true;
+    std::shared_ptr<RpcScheduler> m_rpc_scheduler;  // drives the async calls to the workers
 
-   protected:
-    void Query() override;
+    static constexpr size_t kApiBatchSize = 1000;  // messages per stream of the user facing writes
+    static constexpr std::chrono::seconds kConnectTimeout{5};
+
+    size_t WorkerFor(const std::string& key) const;
+    template <typename EmitEdge, typename EmitVertex>
+    void RouteEdge(std::string from, std::string to, std::string label, EmitEdge&& emit_edge,
+                   EmitVertex&& emit_vertex);
+    Task<bool> UpsertEdgesTo(size_t worker, const std::vector<Edge>& edges);
+    Task<bool> AddVerticesTo(size_t worker, const std::vector<Vertex>& vertices);
+    Task<bool> DeleteVerticesFrom(size_t worker, const std::vector<Vertex>& vertices);
 
    public:
     GraphOrchestrator(std::string name_);
-    void AddVertex(std::string key, std::string data);
-    void AddEdge(std::string from, std::string to, std::string data);
+    bool AddVertex(std::string key, std::string data);
+    bool AddEdge(std::string from, std::string to, std::string data);
+    // Not started until awaited or spawned. `edges` (and whatever they point into) must outlive the task.
+    Task<bool> Apply(const std::vector<EdgeView>& edges);
     Status Search(std::string query_key, int level, std::vector<std::string>& vertices,
                   std::vector<std::string>& edges);
+
+    /*
+    Writes behind the user facing API. `read` yields the streamed items until it returns false, and they are written
+    in per-worker batches while reading goes on (see WritePipeline). `count` is how many items were read. Returns OK
+    once the workers have acknowledged all of them, UNAVAILABLE if the graph is unhealthy or a write failed. Part of
+    the items may have been written then; writes are idempotent, so the client can send them all again.
+    */
+    Status AddVertices(const std::function<bool(orchestrator::ApiVertex&)>& read, size_t& count);
+    Status DeleteVertices(const std::function<bool(orchestrator::ApiVertex&)>& read, size_t& count);
+    Status AddEdges(const std::function<bool(orchestrator::ApiEdge&)>& read, size_t& count);
+    Status DeleteEdges(const std::function<bool(orchestrator::ApiEdge&)>& read, size_t& count);
     void Init();
-    void Ping();
+    Task<void> Ping();
     bool Healthy();
-    void Stop() override;
 
     friend class OrchestratorBuilder;
 };
@@ -5,6 +5,27 @@
 HealthChecker::HealthChecker(std::string name, std::shared_ptr<GraphOrchestrator> orchestrator)
     : m_name(name), m_orchestrator(orchestrator) {}
 
-void HealthChecker::Query() { m_orchestrator->Ping(); }
+// Starts a round of pings unless one is still out. The pings complete on the RPC scheduler, never on this thread.
+bool HealthChecker::Query() {
+    if (m_pinging.exchange(true)) {
+        return false;
+    }
 
-void HealthChecker::Stop() {}
\ No newline at end of file
+    std::promise<void> pinged;
+    m_pinged = pinged.get_future();
+    Spawn(m_orchestrator->Ping(), [this, pinged = std::move(pinged)](std::exception_ptr error) mutable {
+        if (error) {
+            LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "Ping threw");
+        }
+        m_pinging.store(false);
+        // Last, Stop() may let go of the checker as soon as this is set
+        pinged.set_value();
+    });
+    return false;
+}
+
+void HealthChecker::Stop() {
+    if (m_pinged.valid()) {
+        m_pinged.wait();
+    }
+}
\ No newline at end of file
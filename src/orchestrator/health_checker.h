@@ -1,6 +1,8 @@
 #ifndef HEALTH_CHECKER_H
 #define HEALTH_CHECKER_H
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -11,9 +13,11 @@ class HealthChecker : public DataSource {
    private:
     std::string m_name;
     std::shared_ptr<GraphOrchestrator> m_orchestrator;
+    std::atomic<bool> m_pinging = false;  // one round of pings at a time
+    std::future<void> m_pinged;           // Stop() waits for the round still out
 
    protected:
-    void Query() override;
+    bool Query() override;
 
    public:
     HealthChecker(std::string name, std::shared_ptr<GraphOrchestrator> orchestrator);
@@ -0,0 +1,104 @@
+#include "ingest_shard.h"
+
+#include "../logging/logging.h"
+
+IngestShard::IngestShard(std::string name, std::shared_ptr<GraphOrchestrator> orchestrator,
+                         std::vector<std::shared_ptr<SpscQueue<Payload>>> lanes, size_t batch_size)
+    : m_name(name), m_orchestrator(orchestrator), m_lanes(std::move(lanes)), m_batch_size(batch_size) {}
+
+bool IngestShard::Next(Payload& payload) {
+    for (size_t i = 0; i < m_lanes.size(); ++i) {
+        size_t lane = m_next_lane;
+        m_next_lane = (m_next_lane + 1) % m_lanes.size();
+        if (m_lanes[lane]->TryPop(payload)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void IngestShard::TakeGroup() {
+    m_edges.clear();
+    m_decoder.Reset();
+
+    Payload payload;
+    while (m_group.size() < m_batch_size && Next(payload)) {
+        LOG_DEBUG(m_name, "Got {}", payload.Data());
+
+        if (!m_decoder.Decode(payload, m_edges)) {
+            // Retrying won't fix it. It is acked with the group so it doesn't hold back the commit position forever.
+            LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "Malformed payload: '{}'", payload.Data());
+        }
+        if (m_decoder.Malformed() > 0) {
+            LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "Skipped {} malformed lines", m_decoder.Malformed());
+        }
+        m_group.push_back(std::move(payload));
+    }
+}
+
+void IngestShard::AckGroup() {
+    for (auto& payload : m_group) {
+        payload.Ack();
+    }
+    m_group.clear();
+}
+
+/*
+The completion runs on whichever thread finished the last write. It only touches the group, which polls leave alone
+until m_applying is cleared. A failed group waits for the next poll, a written one makes room for the next right away.
+*/
+void IngestShard::StartApply() {
+    std::promise<void> applied;
+    m_applied = applied.get_future();
+    m_applying.store(true);
+    Spawn(m_orchestrator->Apply(m_edges), [this, applied = std::move(applied)](std::exception_ptr error,
+                                                                                 bool ok) mutable {
+        if (error) {
+            LOG_EVERY_MS(Logging::Level::ERROR, 1000, m_name, "Apply threw, retrying the group");
+        }
+        if (ok) {
+            AckGroup();
+        }
+        m_applying.store(false);
+        if (ok) {
+            Notify();
+        }
+        // Last, Stop() may let go of the shard as soon as this is set
+        applied.set_value();
+    });
+}
+
+bool IngestShard::Query() {
+    if (m_applying.load()) {
+        // The writes notify us once they are done
+        return false;
+    }
+
+    // A group that failed goes again as it is, its edges are still valid
+    if (m_group.empty()) {
+        TakeGroup();
+    }
+    if (m_group.empty()) {
+        return false;
+    }
+    if (m_edges.empty()) {
+        // Nothing but malformed payloads, there is nothing to write
+        AckGroup();
+        return true;
+    }
+
+    StartApply();
+    return false;
+}
+
+void IngestShard::Stop() {
+    if (m_applied.valid()) {
+        m_applied.wait();
+    }
+
+    size_t pending = m_group.size();
+    for (const auto& lane : m_lanes) {
+        pending += lane->Size();
+    }
+    Logging::INFO("Stopping with " + std::to_string(pending) + " pending payloads", m_name);
+}
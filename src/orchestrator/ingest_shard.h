@@ -0,0 +1,67 @@
+#ifndef INGEST_SHARD_H
+#define INGEST_SHARD_H
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../data_source.h"
+#include "../payload.h"
+#include "../spsc_queue.h"
+#include "edge_decoder.h"
+#include "graph_orchestrator.h"
+
+/**
+ * Applies the payloads of one shard of the ingest queue to the graph. Each shard is polled by its own thread, so
+ * payloads of the same shard (same source vertex) are applied in order while shards run in parallel.
+ *
+ * Up to a batch of waiting payloads is decoded into one group of edges and written with a single Apply(), so a
+ * group costs one round of streams per worker rather than one per payload. Its payloads are acked (and their offsets
+ * become committable) only after all of its writes were acknowledged by the workers. If a write fails the shard
+ * holds on to the whole group and retries it before taking anything newer.
+ *
+ * Polls never wait for the workers. A poll starts the writes of a group and returns, and the writes notify the shard
+ * once they are done, so the next poll picks up right where this one left off.
+ *
+ * Every producer (Kafka consumer, file replay) hands this shard its payloads through a lane of its own, a single
+ * producer single consumer ring. Lanes are drained round robin, each one in order.
+ **/
+class IngestShard : public DataSource {
+   private:
+    std::string m_name;
+    std::shared_ptr<GraphOrchestrator> m_orchestrator;
+    std::vector<std::shared_ptr<SpscQueue<Payload>>> m_lanes;
+    size_t m_next_lane = 0;
+    size_t m_batch_size;
+    EdgeDecoder m_decoder;
+    /*
+    The current group and its edges. It stays until it is written, a failed one is applied again on the next poll.
+    Malformed payloads are part of it too, so acks still go out in order.
+    */
+    std::vector<Payload> m_group;
+    std::vector<EdgeView> m_edges;
+
+    // Set while the writes of m_group are out. Polls leave everything alone until they are done.
+    std::atomic<bool> m_applying = false;
+    std::future<void> m_applied;  // Stop() waits for the writes still out
+
+    // Takes up to a batch of waiting payloads into m_group and decodes them into m_edges
+    void TakeGroup();
+    void StartApply();
+    void AckGroup();
+
+    // Pops from the next lane that has something, starting where the last pop left off
+    bool Next(Payload& payload);
+
+   protected:
+    bool Query() override;
+
+   public:
+    IngestShard(std::string name, std::shared_ptr<GraphOrchestrator> orchestrator,
+                std::vector<std::shared_ptr<SpscQueue<Payload>>> lanes, size_t batch_size = 256);
+    void Stop() override;
+};
+
+#endif
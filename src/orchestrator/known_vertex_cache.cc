@@ -0,0 +1,87 @@
+#include "known_vertex_cache.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+KnownVertexCache::KnownVertexCache(size_t capacity, size_t workers, size_t stripes) : m_epochs(workers) {
+    if (capacity == 0 || stripes == 0) {
+        throw std::invalid_argument("KnownVertexCache needs a capacity and at least one stripe");
+    }
+
+    m_stripe_capacity = std::max<size_t>(1, capacity / stripes);
+    m_stripes.reserve(stripes);
+    for (size_t i = 0; i < stripes; ++i) {
+        m_stripes.emplace_back(std::make_unique<Stripe>());
+    }
+}
+
+KnownVertexCache::Stripe& KnownVertexCache::StripeFor(const std::string& key) {
+    return *m_stripes[std::hash<std::string>{}(key) % m_stripes.size()];
+}
+
+uint64_t KnownVertexCache::Epoch(size_t worker) const { return m_epochs[worker].load(); }
+
+bool KnownVertexCache::Contains(const std::string& key, size_t worker) {
+    Stripe& stripe = StripeFor(key);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.index.find(key);
+    if (it == stripe.index.end()) {
+        return false;
+    }
+    std::list<Entry>::iterator entry = it->second;
+    if (entry->worker != worker || entry->epoch != m_epochs[worker].load()) {
+        // Stale, the worker was invalidated since
+        stripe.index.erase(it);
+        stripe.lru.erase(entry);
+        return false;
+    }
+    stripe.lru.splice(stripe.lru.begin(), stripe.lru, entry);
+    return true;
+}
+
+void KnownVertexCache::Insert(const std::string& key, size_t worker, uint64_t epoch) {
+    Stripe& stripe = StripeFor(key);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.index.find(key);
+    if (it != stripe.index.end()) {
+        it->second->worker = worker;
+        it->second->epoch = epoch;
+        stripe.lru.splice(stripe.lru.begin(), stripe.lru, it->second);
+        return;
+    }
+
+    stripe.lru.push_front({key, worker, epoch});
+    stripe.index.emplace(stripe.lru.front().key, stripe.lru.begin());
+    if (stripe.lru.size() > m_stripe_capacity) {
+        stripe.index.erase(stripe.lru.back().key);
+        stripe.lru.pop_back();
+    }
+}
+
+void KnownVertexCache::Erase(const std::string& key) {
+    Stripe& stripe = StripeFor(key);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.index.find(key);
+    if (it == stripe.index.end()) {
+        return;
+    }
+    std::list<Entry>::iterator entry = it->second;
+    stripe.index.erase(it);
+    stripe.lru.erase(entry);
+}
+
+// Stale entries are dropped as Contains() comes across them, or age out of the LRU
+void KnownVertexCache::Invalidate(size_t worker) { m_epochs[worker].fetch_add(1); }
+
+size_t KnownVertexCache::Size() {
+    size_t size = 0;
+    for (auto& stripe : m_stripes) {
+        std::lock_guard<std::mutex> lock(stripe->mutex);
+        size += stripe->lru.size();
+    }
+    return size;
+}
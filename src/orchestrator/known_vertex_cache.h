@@ -0,0 +1,61 @@
+#ifndef KNOWN_VERTEX_CACHE_H
+#define KNOWN_VERTEX_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Remembers vertices the workers are known to have, so directed ingest can skip the AddVertex for edge targets on
+ * other workers. Undirected ingest never needs it: both halves of an edge are upserts creating their own source.
+ *
+ * A bounded LRU of recently written keys. Keys evicted from it are simply written again (AddVertex is idempotent).
+ *
+ * Every entry belongs to the worker owning the vertex and carries that worker's epoch from when it was written.
+ * Invalidate() bumps the epoch, which turns all of the worker's entries stale at once: a failed write may have left
+ * the worker without the vertex, and a worker that restarted has an empty graph.
+ *
+ * The cache is split into stripes, each with its own lock, so the ingest shards rarely contend.
+ **/
+class KnownVertexCache {
+   public:
+    KnownVertexCache(size_t capacity, size_t workers, size_t stripes = 16);
+
+    // Take it before writing to `worker`, and insert what the write created with it
+    uint64_t Epoch(size_t worker) const;
+    bool Contains(const std::string& key, size_t worker);
+    void Insert(const std::string& key, size_t worker, uint64_t epoch);
+    // Forget a deleted vertex.
+    void Erase(const std::string& key);
+    // Forget everything known about `worker`.
+    void Invalidate(size_t worker);
+    // Entries held, stale ones included
+    size_t Size();
+
+   private:
+    struct Entry {
+        std::string key;
+        size_t worker;
+        uint64_t epoch;
+    };
+
+    struct Stripe {
+        std::mutex mutex;
+        std::list<Entry> lru;  // most recently used first
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+    };
+
+    Stripe& StripeFor(const std::string& key);
+
+    size_t m_stripe_capacity;
+    std::vector<std::unique_ptr<Stripe>> m_stripes;
+    std::vector<std::atomic<uint64_t>> m_epochs;  // by worker
+};
+
+#endif
@@ -11,7 +11,7 @@
 #include <memory>
 #include <string>
 
-#include "../grpc/orchestrator.grpc.pb.h"
+#include "orchestrator.grpc.pb.h"
 #include "graph_orchestrator.h"
 #include "logging/logging.h"
 
@@ -43,40 +43,40 @@ class OrchestratorApi final : public Orchestrator::Service {
     explicit OrchestratorApi(const std::string& name, std::shared_ptr<GraphOrchestrator> orchestrator)
         : m_name(name), m_orchestrator(orchestrator) {}
 
+    /*
+    The write streams go straight into the orchestrator's pipelined fan-out, see GraphOrchestrator::AddVertices().
+    The summary counts the items written.
+    */
     Status AddVertex(ServerContext* context, ServerReader<ApiVertex>* reader, ApiGraphSummary* response) override {
-        ApiVertex vertex;
-        while (reader->Read(&vertex)) {
-            Logging::INFO("Add vertex with key: '" + vertex.key() + "' and value: '" + vertex.value() + "'", m_name);
-        }
-        response->set_vertex_count(0);
-        return Status::OK;
+        size_t count = 0;
+        Status status = m_orchestrator->AddVertices([reader](ApiVertex& v) { return reader->Read(&v); }, count);
+        LOG_DEBUG(m_name, "Added {} vertices", count);
+        response->set_vertex_count(count);
+        return status;
     }
 
     Status DeleteVertex(ServerContext* context, ServerReader<ApiVertex>* reader, ApiGraphSummary* response) override {
-        ApiVertex vertex;
-        while (reader->Read(&vertex)) {
-            Logging::INFO("Delete vertex with key: '" + vertex.key() + "'", m_name);
-        }
-        response->set_vertex_count(0);
-        return Status::OK;
+        size_t count = 0;
+        Status status = m_orchestrator->DeleteVertices([reader](ApiVertex& v) { return reader->Read(&v); }, count);
+        LOG_DEBUG(m_name, "Deleted {} vertices", count);
+        response->set_vertex_count(count);
+        return status;
     }
 
     Status DeleteEdge(ServerContext* context, ServerReader<ApiEdge>* reader, ApiGraphSummary* response) override {
-        ApiEdge edge;
-        while (reader->Read(&edge)) {
-            Logging::INFO("Delete edge: '" + edge.from() + "'---->'" + edge.to() + "'", m_name);
-        }
-        response->set_edge_count(0);
-        return Status::OK;
+        size_t count = 0;
+        Status status = m_orchestrator->DeleteEdges([reader](ApiEdge& e) { return reader->Read(&e); }, count);
+        LOG_DEBUG(m_name, "Deleted {} edges", count);
+        response->set_edge_count(count);
+        return status;
     }
 
     Status AddEdge(ServerContext* context, ServerReader<ApiEdge>* reader, ApiGraphSummary* response) override {
-        ApiEdge edge;
-        while (reader->Read(&edge)) {
-            Logging::INFO("Add edge: '" + edge.from() + "'--[" + edge.label() + "]-->'" + edge.to() + "'", m_name);
-        }
-        response->set_edge_count(0);
-        return Status::OK;
+        size_t count = 0;
+        Status status = m_orchestrator->AddEdges([reader](ApiEdge& e) { return reader->Read(&e); }, count);
+        LOG_DEBUG(m_name, "Added {} edges", count);
+        response->set_edge_count(count);
+        return status;
     }
 
     Status Search(ServerContext* context, const ApiSearchArgs* request, ApiSearchResults* response) override {
@@ -18,8 +18,27 @@ OrchestratorBuilder& OrchestratorBuilder::WithWorkers(std::map<std::string, std:
     return *this;
 }
 
-OrchestratorBuilder& OrchestratorBuilder::WithInputQueue(std::shared_ptr<LockFreeQueue<std::string>> v) {
-    m_input_queue = v;
+// Remember up to `capacity` vertices known to exist on the workers. 0 disables the cache, so do undirected edges.
+OrchestratorBuilder& OrchestratorBuilder::WithVertexCache(size_t capacity) {
+    m_vertex_cache_capacity = capacity;
+    return *this;
+}
+
+// Write ingested edges in both directions (default) or only from -> to.
+OrchestratorBuilder& OrchestratorBuilder::WithUndirectedEdges(bool v) {
+    m_undirected = v;
+    return *this;
+}
+
+// Completion queue threads driving the calls to the workers. Without one the orchestrator gets a single thread.
+OrchestratorBuilder& OrchestratorBuilder::WithRpcScheduler(std::shared_ptr<RpcScheduler> v) {
+    m_rpc_scheduler = v;
+    return *this;
+}
+
+// Connections to every worker, calls are spread over them round robin. Defaults to one.
+OrchestratorBuilder& OrchestratorBuilder::WithChannelsPerWorker(size_t v) {
+    m_channels_per_worker = v;
     return *this;
 }
 
@@ -32,10 +51,6 @@ std::shared_ptr<GraphOrchestrator> OrchestratorBuilder::Build() {
         throw std::runtime_error("No workers configuration provided");
     }
 
-    if (!m_input_queue) {
-        throw std::runtime_error("No input queue provided");
-    }
-
     std::shared_ptr<GraphOrchestrator> orchestrator = std::make_shared<GraphOrchestrator>(m_name);
 
     std::vector<GraphClient> worker_clients;
@@ -43,12 +58,19 @@ std::shared_ptr<GraphOrchestrator> OrchestratorBuilder::Build() {
     for (const auto& [id, port] : m_workers_config) {
         std::string address = "localhost:" + port;
         worker_address.emplace_back(address);
-        worker_clients.emplace_back(GraphClient(grpc::CreateChannel(address, grpc::InsecureChannelCredentials())));
+        worker_clients.emplace_back(
+            GraphClient(std::make_shared<ChannelPool<graph::Graph>>(address, m_channels_per_worker)));
     }
 
     orchestrator->m_worker_address = std::move(worker_address);
     orchestrator->m_worker_clients = std::move(worker_clients);
-    orchestrator->m_input_queue = m_input_queue;
+    orchestrator->m_undirected = m_undirected;
+    orchestrator->m_rpc_scheduler = m_rpc_scheduler ? m_rpc_scheduler : std::make_shared<RpcScheduler>();
+    // Undirected ingest never writes vertices of its own, there is nothing to skip
+    if (m_vertex_cache_capacity > 0 && !m_undirected) {
+        orchestrator->m_known_vertices =
+            std::make_unique<KnownVertexCache>(m_vertex_cache_capacity, m_workers_config.size());
+    }
 
     return orchestrator;
 }
\ No newline at end of file
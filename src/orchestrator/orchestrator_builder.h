@@ -5,7 +5,7 @@
 #include <memory>
 #include <string>
 
-#include "../lock_free_queue.h"
+#include "../rpc_scheduler.h"
 #include "graph_orchestrator.h"
 
 class OrchestratorBuilder {
@@ -13,12 +13,18 @@ class OrchestratorBuilder {
     std::string m_name;
     std::map<std::string, std::string> m_workers_config;
     std::string m_db_content;
-    std::shared_ptr<LockFreeQueue<std::string>> m_input_queue;
+    size_t m_vertex_cache_capacity = 0;
+    bool m_undirected = true;
+    size_t m_channels_per_worker = 1;
+    std::shared_ptr<RpcScheduler> m_rpc_scheduler;
 
    public:
     OrchestratorBuilder& WithName(std::string v);
     OrchestratorBuilder& WithWorkers(std::map<std::string, std::string> v);
-    OrchestratorBuilder& WithInputQueue(std::shared_ptr<LockFreeQueue<std::string>> v);
+    OrchestratorBuilder& WithVertexCache(size_t capacity);
+    OrchestratorBuilder& WithUndirectedEdges(bool v);
+    OrchestratorBuilder& WithRpcScheduler(std::shared_ptr<RpcScheduler> v);
+    OrchestratorBuilder& WithChannelsPerWorker(size_t v);
     std::shared_ptr<GraphOrchestrator> Build();
 };
 
@@ -0,0 +1,99 @@
+#ifndef WRITE_PIPELINE_H
+#define WRITE_PIPELINE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include "../task.h"
+
+/**
+ * Streams writes to the workers in per-worker batches. Add() routes a message to its worker's batch and starts sending
+ * the batch as soon as it is full, so the caller goes on reading the next messages while the last ones are written,
+ * and all workers are written to at once.
+ *
+ * Every worker has at most one batch in flight and the next one waits for it. One worker thus applies its writes in
+ * the order they were added, and a slow worker slows the caller down instead of piling up batches. The two batches of
+ * a worker take turns, so their buffers are only allocated once.
+ **/
+template <typename Message>
+class WritePipeline {
+   public:
+    // Writes `batch` to the worker at index `worker`. The batch stays alive and unchanged until the task is done.
+    using Send = std::function<Task<bool>(size_t worker, const std::vector<Message>& batch)>;
+
+    WritePipeline(size_t workers, size_t batch_size, Send send)
+        : m_lanes(workers), m_batch_size(std::max<size_t>(batch_size, 1)), m_send(std::move(send)) {}
+
+    // The batches still in flight refer to our buffers
+    ~WritePipeline() {
+        for (auto& lane : m_lanes) {
+            Wait(lane);
+        }
+    }
+
+    WritePipeline(const WritePipeline&) = delete;
+    WritePipeline& operator=(const WritePipeline&) = delete;
+
+    void Add(size_t worker, Message message) {
+        Lane& lane = m_lanes[worker];
+        lane.filling.push_back(std::move(message));
+        if (lane.filling.size() >= m_batch_size) {
+            Flush(lane, worker);
+        }
+    }
+
+    // Sends the partial batches and waits for everything in flight. Returns whether every batch was acknowledged.
+    bool Finish() {
+        for (size_t i = 0; i < m_lanes.size(); ++i) {
+            if (!m_lanes[i].filling.empty()) {
+                Flush(m_lanes[i], i);
+            }
+        }
+        for (auto& lane : m_lanes) {
+            Wait(lane);
+        }
+        return !Failed();
+    }
+
+    // Whether a batch that has completed so far was rejected. Callers may stop adding then.
+    bool Failed() {
+        for (auto& lane : m_lanes) {
+            if (lane.done.valid() && lane.done.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                Wait(lane);
+            }
+        }
+        return m_failed > 0;
+    }
+
+   private:
+    struct Lane {
+        std::vector<Message> filling;
+        std::vector<Message> in_flight;
+        std::future<bool> done;
+    };
+
+    std::vector<Lane> m_lanes;
+    size_t m_batch_size;
+    Send m_send;
+    size_t m_failed = 0;
+
+    void Wait(Lane& lane) {
+        if (lane.done.valid() && !lane.done.get()) {
+            ++m_failed;
+        }
+    }
+
+    void Flush(Lane& lane, size_t worker) {
+        Wait(lane);
+        lane.in_flight.swap(lane.filling);
+        lane.filling.clear();
+        lane.done = Spawn(m_send(worker, lane.in_flight));
+    }
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef PAYLOAD_H
+#define PAYLOAD_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "offset_tracker.h"
+
+// How the bytes of a payload are encoded.
+enum class PayloadFormat : uint8_t {
+    JSON_EDGE = 0,   // A single {"from": ..., "to": ..., "label": ...} object
+    EDGE_BATCH = 1,  // A serialized graph::EdgeBatch
+    NDJSON = 2,      // JSON_EDGE objects, one per line
+};
+
+/**
+ * Message body handed from a data source to the orchestrator without copying it.
+ *
+ * The payload owns whatever the bytes live in (e.g. the RdKafka::Message that received them) and only exposes a view
+ * on them. Moving a payload through a queue moves the owner, so the bytes are first read again by the parser on the
+ * other side and released once the payload goes out of scope there.
+ **/
+class Payload {
+   private:
+    using Owner = std::unique_ptr<void, void (*)(void *)>;
+    Owner m_owner;
+    std::string_view m_data;
+    PayloadFormat m_format = PayloadFormat::JSON_EDGE;
+
+    // Where the payload came from, reported back to the tracker once it has been applied.
+    std::shared_ptr<OffsetTracker> m_tracker;
+    std::string m_topic;
+    int32_t m_partition = -1;
+    int64_t m_offset = -1;
+
+   public:
+    // An empty payload that holds nothing. Evaluates to false.
+    Payload() : m_owner(nullptr, [](void *) {}) {}
+
+    // Copies `s` once into a heap string owned by the payload. For sources that don't own a buffer to hand over.
+    explicit Payload(std::string s) : Payload() {
+        std::string *owned = new std::string(std::move(s));
+        *this = Own(owned, owned->data(), owned->size());
+    }
+
+    Payload(Payload &&) = default;
+    Payload &operator=(Payload &&) = default;
+    Payload(const Payload &) = delete;
+    Payload &operator=(const Payload &) = delete;
+
+    /*
+    Takes ownership of `owner`. `data` and `size` must describe memory that stays valid for as long as `owner` lives.
+    */
+    template <typename T>
+    static Payload Own(T *owner, const char *data, size_t size) {
+        Payload payload;
+        payload.m_owner = Owner(owner, [](void *o) { delete static_cast<T *>(o); });
+        payload.m_data = std::string_view(data, size);
+        return payload;
+    }
+
+    std::string_view Data() const { return m_data; }
+    size_t Size() const { return m_data.size(); }
+    explicit operator bool() const { return m_owner != nullptr; }
+
+    PayloadFormat Format() const { return m_format; }
+    void SetFormat(PayloadFormat format) { m_format = format; }
+
+    /*
+    Registers the payload with `tracker`. Ack() must be called once the payload has been durably applied, only then
+    does its offset become committable.
+    */
+    void TrackWith(std::shared_ptr<OffsetTracker> tracker, std::string topic, int32_t partition, int64_t offset) {
+        tracker->Track(topic, partition, offset);
+        m_tracker = std::move(tracker);
+        m_topic = std::move(topic);
+        m_partition = partition;
+        m_offset = offset;
+    }
+
+    void Ack() const {
+        if (m_tracker) {
+            m_tracker->Done(m_topic, m_partition, m_offset);
+        }
+    }
+};
+
+#endif
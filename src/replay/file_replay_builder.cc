@@ -0,0 +1,106 @@
+#include "file_replay_builder.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#include "../logging/logging.h"
+
+FileReplayBuilder& FileReplayBuilder::WithName(std::string v) {
+    m_name = v;
+    return *this;
+}
+
+FileReplayBuilder& FileReplayBuilder::WithPath(std::string v) {
+    m_path = v;
+    return *this;
+}
+
+// NDJSON or EDGE_BATCH (length prefixed records)
+FileReplayBuilder& FileReplayBuilder::WithFormat(PayloadFormat v) {
+    m_format = v;
+    return *this;
+}
+
+FileReplayBuilder& FileReplayBuilder::WithOutputQueue(std::shared_ptr<ShardedQueue<Payload, SpscQueue>> v) {
+    m_output_queue = v;
+    return *this;
+}
+
+// Lines per NDJSON chunk. Binary records are already batches and are handed out as they are.
+FileReplayBuilder& FileReplayBuilder::WithBatchSize(size_t v) {
+    m_batch_size = v;
+    return *this;
+}
+
+// Stop handing out chunks once `high` are waiting to be applied, continue at `low`.
+FileReplayBuilder& FileReplayBuilder::WithWatermarks(size_t high, size_t low) {
+    m_high_watermark = high;
+    m_low_watermark = low;
+    return *this;
+}
+
+FileReplayBuilder& FileReplayBuilder::WithCheckpointInterval(size_t ms) {
+    m_checkpoint_interval_ms = ms;
+    return *this;
+}
+
+std::unique_ptr<FileReplayDataSource> FileReplayBuilder::Build() {
+    if (m_name.empty()) {
+        m_name = "Replay";
+    }
+
+    if (m_path.empty()) {
+        throw std::runtime_error("No replay file provided");
+    }
+
+    if (m_format != PayloadFormat::NDJSON && m_format != PayloadFormat::EDGE_BATCH) {
+        throw std::runtime_error("Replay files are either NDJSON or edge batches");
+    }
+
+    if (!m_output_queue) {
+        throw std::runtime_error("No output queue provided");
+    }
+
+    if (m_batch_size == 0) {
+        throw std::runtime_error("Batch size must be at least 1");
+    }
+
+    if (m_high_watermark == 0 || m_low_watermark >= m_high_watermark) {
+        throw std::runtime_error("Low watermark must be below the high watermark");
+    }
+
+    std::unique_ptr<FileReplayDataSource> replay = std::make_unique<FileReplayDataSource>();
+    replay->m_name = std::move(m_name);
+    replay->m_path = std::move(m_path);
+    replay->m_checkpoint_path = replay->m_path + ".offset";
+    replay->m_format = m_format;
+    replay->m_file = std::make_shared<MappedFile>(replay->m_path);
+    replay->m_output_queue = std::move(m_output_queue);
+    replay->m_offset_tracker = std::make_shared<OffsetTracker>();
+    replay->m_batch_size = m_batch_size;
+    replay->m_high_watermark = m_high_watermark;
+    replay->m_low_watermark = m_low_watermark;
+    replay->m_checkpoint_interval = std::chrono::milliseconds(m_checkpoint_interval_ms);
+    replay->m_poll_interval = FileReplayDataSource::kPausedPollIntervalMs;
+
+    /*
+    Resume from the last checkpoint. It always points at the start of a chunk: a line start or a record length.
+    */
+    size_t resume_at = 0;
+    std::ifstream checkpoint(replay->m_checkpoint_path);
+    if (checkpoint >> resume_at) {
+        if (resume_at > replay->m_file->Size()) {
+            throw std::runtime_error("Checkpoint " + replay->m_checkpoint_path + " is past the end of the file");
+        }
+        Logging::INFO("Resuming " + replay->m_path + " at byte " + std::to_string(resume_at), replay->m_name);
+    }
+    replay->m_position = resume_at;
+    replay->m_end = replay->m_file->Size();
+    replay->m_committed = resume_at;
+    replay->m_checkpointed = resume_at;
+    replay->m_started_at = resume_at;
+    replay->m_started = std::chrono::steady_clock::now();
+    replay->m_last_checkpoint = replay->m_started;
+
+    return replay;
+}
@@ -0,0 +1,33 @@
+#ifndef FILE_REPLAY_BUILDER_H
+#define FILE_REPLAY_BUILDER_H
+
+#include <memory>
+#include <string>
+
+#include "../payload.h"
+#include "../sharded_queue.h"
+#include "file_replay_data_source.h"
+
+class FileReplayBuilder {
+   private:
+    std::string m_name;
+    std::string m_path;
+    PayloadFormat m_format = PayloadFormat::NDJSON;
+    std::shared_ptr<ShardedQueue<Payload, SpscQueue>> m_output_queue;
+    size_t m_batch_size = 1024;
+    size_t m_high_watermark = 64;
+    size_t m_low_watermark = 32;
+    size_t m_checkpoint_interval_ms = 1000;
+
+   public:
+    FileReplayBuilder& WithName(std::string v);
+    FileReplayBuilder& WithPath(std::string v);
+    FileReplayBuilder& WithFormat(PayloadFormat v);
+    FileReplayBuilder& WithOutputQueue(std::shared_ptr<ShardedQueue<Payload, SpscQueue>> v);
+    FileReplayBuilder& WithBatchSize(size_t v);
+    FileReplayBuilder& WithWatermarks(size_t high, size_t low);
+    FileReplayBuilder& WithCheckpointInterval(size_t ms);
+    std::unique_ptr<FileReplayDataSource> Build();
+};
+
+#endif
@@ -0,0 +1,149 @@
+#include "file_replay_data_source.h"
+
+#include <cstdint>
+#include <cstdio>  // std::rename(), std::snprintf()
+#include <cstring>
+#include <fstream>
+
+#include "../logging/logging.h"
+
+bool FileReplayDataSource::Query() {
+    if (m_done) {
+        return false;
+    }
+
+    /*
+    Same hysteresis as the Kafka consumers: stop handing out chunks once `high` wait in the shards and only start again
+    once they are down to `low`. Otherwise a fast disk would map the whole file into the queues.
+    */
+    size_t backlog = m_output_queue->Size();
+    if (m_paused && backlog <= m_low_watermark) {
+        m_paused = false;
+    }
+
+    while (!m_paused && (m_pending || m_position < m_end)) {
+        if (!m_pending && !NextChunk(m_pending)) {
+            // Nothing past it can be cut. Finish the chunks handed out so far, the checkpoint stops right here.
+            Logging::ERROR("Truncated record at byte " + std::to_string(m_position) + ", stopping replay", m_name);
+            m_end = m_position;
+            break;
+        }
+
+        // Upserts commute, so chunks don't need to stick to a shard. Spread them evenly.
+        if (!m_output_queue->Push(m_next_shard % m_output_queue->Shards(), std::move(m_pending))) {
+            // Keep it and try the same shard again next time
+            break;
+        }
+        ++m_next_shard;
+        if (m_output_queue->Size() >= m_high_watermark) {
+            m_paused = true;
+        }
+    }
+
+    if (std::chrono::steady_clock::now() - m_last_checkpoint >= m_checkpoint_interval) {
+        Checkpoint();
+    }
+
+    // We only stop handing out chunks when paused, blocked on a full shard or done. Nothing to do right away.
+    return false;
+}
+
+/*
+Cuts the next chunk at m_position. Its tracked offset is the chunk's last byte, so the committable position (one past
+it) is exactly where the next chunk starts.
+*/
+bool FileReplayDataSource::NextChunk(Payload &payload) {
+    const char *data = m_file->Data();
+    size_t size = m_file->Size();
+    size_t begin = m_position;
+    size_t end = begin;
+
+    if (m_format == PayloadFormat::EDGE_BATCH) {
+        // Little endian whatever the host is
+        const size_t kLengthBytes = 4;
+        if (size - begin < kLengthBytes) {
+            return false;
+        }
+        const auto *bytes = reinterpret_cast<const unsigned char *>(data + begin);
+        uint32_t length = uint32_t(bytes[0]) | uint32_t(bytes[1]) << 8 | uint32_t(bytes[2]) << 16 |
+                          uint32_t(bytes[3]) << 24;
+        begin += kLengthBytes;
+        if (size - begin < length) {
+            return false;
+        }
+        end = begin + length;
+    } else {
+        for (size_t lines = 0; lines < m_batch_size && end < size; ++lines) {
+            const void *eol = std::memchr(data + end, '\n', size - end);
+            end = eol ? static_cast<const char *>(eol) - data + 1 : size;
+        }
+    }
+
+    payload = Payload::Own(new std::shared_ptr<MappedFile>(m_file), data + begin, end - begin);
+    payload.SetFormat(m_format);
+    payload.TrackWith(m_offset_tracker, m_path, 0, static_cast<int64_t>(end) - 1);
+    m_position = end;
+    return true;
+}
+
+/*
+Writes how far the shards have applied the file to the checkpoint, unless that hasn't moved since the last write.
+Once it reaches the end of the file (or a truncated record) the replay is done and polled only rarely until it is
+stopped.
+*/
+void FileReplayDataSource::Checkpoint() {
+    auto now = std::chrono::steady_clock::now();
+    m_last_checkpoint = now;
+    if (m_done) {
+        return;
+    }
+
+    for (const auto &position : m_offset_tracker->Committable()) {
+        m_committed = static_cast<size_t>(position.offset);
+    }
+
+    if (m_committed != m_checkpointed) {
+        // Write aside and rename, so a crash never leaves a half written checkpoint behind
+        std::string tmp = m_checkpoint_path + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            out << m_committed << std::endl;
+            if (!out) {
+                Logging::ERROR("Failed to write checkpoint " + tmp, m_name);
+                return;
+            }
+        }
+        if (std::rename(tmp.c_str(), m_checkpoint_path.c_str()) != 0) {
+            Logging::ERROR("Failed to write checkpoint " + m_checkpoint_path, m_name);
+            return;
+        }
+        m_checkpointed = m_committed;
+
+        double seconds = std::chrono::duration<double>(now - m_started).count();
+        double mb = 1024.0 * 1024.0;
+        double rate = seconds > 0 ? (m_committed - m_started_at) / mb / seconds : 0;
+        double percent = m_file->Size() > 0 ? 100.0 * m_committed / m_file->Size() : 100.0;
+        char progress[128];
+        std::snprintf(progress, sizeof(progress), "Applied %.1f of %.1f MB (%.1f%%) at %.1f MB/s", m_committed / mb,
+                      m_file->Size() / mb, percent, rate);
+        Logging::INFO(progress, m_name);
+    }
+
+    if (m_committed >= m_end) {
+        if (m_end < m_file->Size()) {
+            Logging::ERROR("Replay of " + m_path + " stopped at the truncated record at byte " + std::to_string(m_end),
+                           m_name);
+        } else {
+            Logging::INFO("Replay of " + m_path + " complete", m_name);
+        }
+        m_done = true;
+        m_poll_interval = kDonePollIntervalMs;
+    }
+}
+
+void FileReplayDataSource::Stop() {
+    Checkpoint();
+    Logging::INFO("Stopped at byte " + std::to_string(m_committed) + ", " +
+                      std::to_string(m_offset_tracker->InFlight()) + " chunks in flight will be replayed",
+                  m_name);
+}
@@ -0,0 +1,72 @@
+#ifndef FILE_REPLAY_DATA_SOURCE_H
+#define FILE_REPLAY_DATA_SOURCE_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "../data_source.h"
+#include "../offset_tracker.h"
+#include "../payload.h"
+#include "../sharded_queue.h"
+#include "mapped_file.h"
+
+class FileReplayBuilder;
+
+/**
+ * Replays an edge file into the ingest shards, e.g. to backfill history without going through Kafka or to benchmark
+ * ingest locally.
+ *
+ * The file is memory mapped and cut into chunks that are handed to the shards as payloads pointing straight into the
+ * mapping, no copies. Two formats are understood:
+ *  - NDJSON: one {"from","to","label"} object per line, `batch` lines per chunk
+ *  - EDGE_BATCH: records of a 4 byte little endian length followed by a serialized graph::EdgeBatch, one per chunk
+ *
+ * Chunks are acked by the shards once applied. Every checkpoint interval the position up to which everything has
+ * been applied is written to `<file>.offset`, and a restarted replay continues from there. A truncated record ends
+ * the replay: it is done once everything before the record has been applied and checkpointed.
+ **/
+class FileReplayDataSource : public DataSource {
+   public:
+    // While paused, check the backlog often enough that the shards don't run dry before we resume
+    static constexpr int kPausedPollIntervalMs = 5;
+    // Once the whole file has been applied there is nothing left to do but stop
+    static constexpr int kDonePollIntervalMs = 1000;
+
+   private:
+    std::string m_name;
+    std::string m_path;
+    std::string m_checkpoint_path;
+    PayloadFormat m_format = PayloadFormat::NDJSON;
+    std::shared_ptr<MappedFile> m_file;
+    std::shared_ptr<ShardedQueue<Payload, SpscQueue>> m_output_queue;
+    std::shared_ptr<OffsetTracker> m_offset_tracker;
+    size_t m_batch_size = 1024;
+    size_t m_high_watermark = 64;
+    size_t m_low_watermark = 32;
+    bool m_paused = false;
+    size_t m_position = 0;      // next byte to hand out
+    size_t m_end = 0;           // end of what can be replayed: the file size, or the start of a truncated record
+    size_t m_committed = 0;     // everything before this byte has been applied
+    size_t m_checkpointed = 0;  // what the checkpoint file says
+    size_t m_next_shard = 0;
+    Payload m_pending;  // cut but not handed out yet, its shard was full
+    std::chrono::milliseconds m_checkpoint_interval{1000};
+    std::chrono::steady_clock::time_point m_last_checkpoint;
+    std::chrono::steady_clock::time_point m_started;
+    size_t m_started_at = 0;
+    bool m_done = false;
+
+    bool NextChunk(Payload &payload);
+    void Checkpoint();
+
+   protected:
+    bool Query() override;
+
+   public:
+    void Stop() override;
+
+    friend class FileReplayBuilder;
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <fcntl.h>     // open()
+#include <sys/mman.h>  // mmap()
+#include <sys/stat.h>  // fstat()
+#include <unistd.h>    // close()
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * A read-only memory mapping of a whole file. Unmapped on destruction, so share it (e.g. via std::shared_ptr) with
+ * everything that still holds views into it.
+ **/
+class MappedFile {
+   private:
+    const char *m_data = nullptr;
+    size_t m_size = 0;
+
+   public:
+    explicit MappedFile(const std::string &path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open '" + path + "': " + std::strerror(errno));
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw std::runtime_error("Failed to stat '" + path + "': " + std::strerror(errno));
+        }
+
+        m_size = static_cast<size_t>(st.st_size);
+        if (m_size > 0) {
+            void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("Failed to map '" + path + "': " + std::strerror(errno));
+            }
+            // Read front to back once. Lets the kernel read ahead aggressively and drop pages behind us.
+            madvise(data, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char *>(data);
+        }
+        // The mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~MappedFile() {
+        if (m_data) {
+            munmap(const_cast<char *>(m_data), m_size);
+        }
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const char *Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+    std::string_view View() const { return std::string_view(m_data, m_size); }
+};
+
+#endif
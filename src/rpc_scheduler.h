@@ -0,0 +1,99 @@
+#ifndef RPC_SCHEDULER_H
+#define RPC_SCHEDULER_H
+
+#include <grpcpp/completion_queue.h>
+
+#include <algorithm>
+#include <coroutine>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Drives coroutines waiting for asynchronous gRPC calls. Async calls are started on Queue() with a Completion as
+ * their tag; a few threads take finished operations off the queue and resume the coroutine waiting for each.
+ *
+ * No thread is tied up while a call is in flight, so a handful of them keep any number of calls going. The same goes
+ * for a server's asynchronous methods when the scheduler polls the server's completion queue.
+ **/
+class RpcScheduler {
+   public:
+    // Tag of one asynchronous operation. `ok` is what the completion queue reported for it.
+    struct Completion {
+        std::coroutine_handle<> waiter;
+        bool ok = false;
+    };
+
+    /*
+    co_await-ing it runs `start` with the tag to start the operation under, suspends, and resumes with the
+    operation's `ok` once it has completed:
+
+        bool ok = co_await RpcScheduler::Completes([&](void* tag) { writer->Write(edge, tag); });
+
+    The coroutine may already be resumed on another thread before `start` returns, so nothing after it may touch the
+    awaiter.
+    */
+    template <typename Start>
+    struct Awaiter {
+        Start start;
+        Completion completion;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> waiter) {
+            completion.waiter = waiter;
+            start(static_cast<void*>(&completion));
+        }
+        bool await_resume() const noexcept { return completion.ok; }
+    };
+
+    template <typename Start>
+    static Awaiter<Start> Completes(Start start) {
+        return Awaiter<Start>{std::move(start), {}};
+    }
+
+    explicit RpcScheduler(size_t threads = 1) : RpcScheduler(std::make_unique<grpc::CompletionQueue>(), threads) {}
+
+    /*
+    Polls `queue` instead of a queue of its own, e.g. one from ServerBuilder::AddCompletionQueue(), so incoming calls
+    are served on the same threads as outgoing ones. Shut the server down before destroying the scheduler.
+    */
+    RpcScheduler(std::unique_ptr<grpc::CompletionQueue> queue, size_t threads) : m_queue(std::move(queue)) {
+        for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+            m_threads.emplace_back(&RpcScheduler::Run, this);
+        }
+    }
+
+    /*
+    Waits for the calls still in flight to finish, resuming their coroutines as usual, then joins. Destroy it after
+    everything that starts calls on it.
+    */
+    ~RpcScheduler() {
+        m_queue->Shutdown();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    RpcScheduler(const RpcScheduler&) = delete;
+    RpcScheduler& operator=(const RpcScheduler&) = delete;
+
+    grpc::CompletionQueue* Queue() { return m_queue.get(); }
+    size_t Size() const { return m_threads.size(); }
+
+   private:
+    std::unique_ptr<grpc::CompletionQueue> m_queue;
+    std::vector<std::thread> m_threads;
+
+    void Run() {
+        void* tag = nullptr;
+        bool ok = false;
+        while (m_queue->Next(&tag, &ok)) {
+            Completion* completion = static_cast<Completion*>(tag);
+            completion->ok = ok;
+            completion->waiter.resume();
+        }
+    }
+};
+
+#endif
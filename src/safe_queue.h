@@ -1,23 +1,47 @@
 #ifndef SAFE_QUEUE_H
 #define SAFE_QUEUE_H
 
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <limits>
 #include <mutex>
-#include <queue>
+#include <type_traits>
+#include <utility>
 
 // A threadsafe-queue.
+// Optionally bounded: with a capacity Enqueue waits for room and TryEnqueue gives up instead.
 template <typename T>
 class SafeQueue {
    public:
-    SafeQueue(void) : m_queue(), m_mutex(), m_cv() {}
+    // A capacity of 0 means unbounded.
+    explicit SafeQueue(size_t capacity = 0) : m_queue(), m_mutex(), m_not_empty(), m_not_full(), m_capacity(capacity) {}
 
     ~SafeQueue(void) {}
 
-    // Add an element to the queue.
-    void Enqueue(T t) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(t);
-        m_cv.notify_all();
+    // Add an element to the queue. Waits for room if the queue is bounded and full.
+    void Enqueue(T &&t) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_full.wait(lock, [this]() { return !Full(); });
+        m_queue.push_back(std::move(t));
+        lock.unlock();
+        m_not_empty.notify_one();
+    }
+
+    void Enqueue(const T &t) { Enqueue(T(t)); }
+
+    // Add an element unless the queue is full. `t` is only moved from on success.
+    bool TryEnqueue(T &&t) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (Full()) {
+                return false;
+            }
+            m_queue.push_back(std::move(t));
+        }
+        m_not_empty.notify_one();
+        return true;
     }
 
     // Get the "front"-element.
@@ -26,34 +50,81 @@ class SafeQueue {
         std::unique_lock<std::mutex> lock(m_mutex);
         while (m_queue.empty()) {
             // release lock as long as the wait and reaquire it afterwards.
-            m_cv.wait(lock);
+            m_not_empty.wait(lock);
         }
-        T val = m_queue.front();
-        m_queue.pop();
+        T val = PopFront();
+        lock.unlock();
+        m_not_full.notify_one();
         return val;
     }
 
-    void DequeueWithTimeout(const int ms, T &val) {
+    // Returns false if the queue is empty.
+    bool TryDequeue(T &val) { return DequeueWithTimeout(0, val); }
+
+    // Returns false if nothing arrived within `ms`, `val` is left untouched then.
+    bool DequeueWithTimeout(const int ms, T &val) {
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait_for(lock, std::chrono::milliseconds(ms), [this]() {
-            bool stop_waiting = !m_queue.empty();
-            return stop_waiting;
-        });
-
-        if (!m_queue.empty()) {
-            val = m_queue.front();
-            m_queue.pop();
+        if (!m_not_empty.wait_for(lock, std::chrono::milliseconds(ms), [this]() { return !m_queue.empty(); })) {
+            return false;
         }
+
+        val = PopFront();
+        lock.unlock();
+        m_not_full.notify_one();
+        return true;
     }
 
-    size_t Size() {
-        std::unique_lock<std::mutex> lock(m_mutex);
+    /*
+    Moves up to `max` elements into `out` (appending, in queue order) under a single lock acquisition. Waits up to
+    `wait` for the first element if the queue is empty. Returns how many elements were moved.
+
+    If `out` is an empty std::deque<T> and everything fits, the queue's storage is swapped out wholesale.
+    */
+    template <typename Container>
+    size_t DrainTo(Container &out, size_t max = std::numeric_limits<size_t>::max(),
+                   std::chrono::milliseconds wait = std::chrono::milliseconds(0)) {
+        size_t drained = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_not_empty.wait_for(lock, wait, [this]() { return !m_queue.empty(); })) {
+                return 0;
+            }
+
+            if constexpr (std::is_same_v<Container, std::deque<T>>) {
+                if (out.empty() && m_queue.size() <= max) {
+                    drained = m_queue.size();
+                    out.swap(m_queue);
+                }
+            }
+            for (; drained < max && !m_queue.empty(); ++drained) {
+                out.push_back(PopFront());
+            }
+        }
+        m_not_full.notify_all();
+        return drained;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
         return m_queue.size();
     }
 
+    size_t Capacity() const { return m_capacity; }
+
    private:
-    std::queue<T> m_queue;
+    std::deque<T> m_queue;
     mutable std::mutex m_mutex;
-    std::condition_variable m_cv;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    size_t m_capacity;
+
+    // Both expect m_mutex to be held
+    bool Full() const { return m_capacity > 0 && m_queue.size() >= m_capacity; }
+
+    T PopFront() {
+        T val = std::move(m_queue.front());
+        m_queue.pop_front();
+        return val;
+    }
 };
 #endif
@@ -0,0 +1,84 @@
+#ifndef SHARDED_QUEUE_H
+#define SHARDED_QUEUE_H
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "lock_free_queue.h"
+#include "spsc_queue.h"
+
+/**
+ * A fixed number of independent queues (shards). Everything pushed with the same shard key ends up in the same shard,
+ * so a single consumer per shard sees those elements in push order while different shards are drained in parallel.
+ *
+ * Producers pick the shard, consumers grab a handle to "their" shard via Shard(i) and drain it.
+ *
+ * Shards are bounded lock free rings. Producers are expected to throttle themselves well below the capacity (see the
+ * watermarks of the data sources). Push never waits for room: producers run as steps on the shared Executor, where a
+ * step must not block, so they hold on to what a full shard refused and offer it again on their next step.
+ *
+ * The ring type is a policy. The default LockFreeQueue takes any number of producers and consumers. With SpscQueue
+ * only a single thread may Push and a single thread may drain each shard, which makes every handoff wait-free; give
+ * each producer its own ShardedQueue in that case.
+ */
+template <typename T, template <typename> class QueuePolicy = LockFreeQueue>
+class ShardedQueue {
+   public:
+    using Queue = QueuePolicy<T>;
+
+    explicit ShardedQueue(size_t shards, size_t capacity_per_shard = 65536) {
+        if (shards == 0) {
+            throw std::invalid_argument("ShardedQueue needs at least one shard");
+        }
+
+        m_shards.reserve(shards);
+        m_on_push.resize(shards);
+        for (size_t i = 0; i < shards; ++i) {
+            m_shards.emplace_back(std::make_shared<Queue>(capacity_per_shard));
+        }
+    }
+
+    size_t Shards() const { return m_shards.size(); }
+
+    // Shard responsible for the given key. Same key, same shard.
+    size_t ShardFor(std::string_view key) const { return std::hash<std::string_view>{}(key) % m_shards.size(); }
+
+    // Pushes `t` to the shard. Returns false if the shard is full, in which case `t` is left untouched.
+    bool Push(size_t shard, T&& t) {
+        shard %= m_shards.size();
+        if (!m_shards[shard]->TryPush(std::move(t))) {
+            return false;
+        }
+        Pushed(shard);
+        return true;
+    }
+
+    std::shared_ptr<Queue> Shard(size_t i) const { return m_shards.at(i); }
+
+    // Called after every successful Push to shard `i`, e.g. to wake its consumer. Set it before producers start.
+    void OnPush(size_t i, std::function<void()> callback) { m_on_push.at(i) = std::move(callback); }
+
+    // Number of elements waiting across all shards.
+    size_t Size() const {
+        size_t size = 0;
+        for (const auto& shard : m_shards) {
+            size += shard->Size();
+        }
+        return size;
+    }
+
+   private:
+    std::vector<std::shared_ptr<Queue>> m_shards;
+    std::vector<std::function<void()>> m_on_push;
+
+    void Pushed(size_t shard) {
+        if (m_on_push[shard]) {
+            m_on_push[shard]();
+        }
+    }
+};
+
+#endif
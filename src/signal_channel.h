@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <mutex>
 
 class SignalChannel
 {
@@ -10,6 +11,23 @@ public:
     std::atomic<bool> m_shutdown_requested = false;
     std::mutex m_cv_mutex;
     std::condition_variable m_cv;
+
+    // Sets the flag under the mutex so a concurrent WaitForShutdown can't miss the notification
+    void RequestShutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_cv_mutex);
+            m_shutdown_requested.store(true);
+        }
+        m_cv.notify_all();
+    }
+
+    // Blocks until RequestShutdown was called
+    void WaitForShutdown()
+    {
+        std::unique_lock<std::mutex> lock(m_cv_mutex);
+        m_cv.wait(lock, [this]() { return m_shutdown_requested.load(); });
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,160 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * Bounded single-producer single-consumer queue.
+ *
+ * Exactly one thread may push and exactly one (other) thread may pop. In exchange every operation is wait-free: the
+ * producer only ever writes the tail, the consumer only ever writes the head, and a push or pop is a plain copy into
+ * the ring plus one release store.
+ *
+ * Each side keeps a private copy of the other side's index and only re-reads the shared one when the copy says the
+ * ring is full (producer) or empty (consumer). As long as the queue is neither, the two threads don't touch each
+ * other's cache lines at all.
+ *
+ * Same interface as LockFreeQueue, so the two can be swapped as a template policy (see ShardedQueue).
+ **/
+template <typename T>
+class SpscQueue {
+   private:
+    static constexpr size_t kCacheLine = 64;
+
+    struct Cell {
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *Element() { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask;
+
+    // Consumer side
+    alignas(kCacheLine) std::atomic<size_t> m_head{0};
+    size_t m_cached_tail = 0;
+
+    // Producer side
+    alignas(kCacheLine) std::atomic<size_t> m_tail{0};
+    size_t m_cached_head = 0;
+
+    // Keeps whatever follows the queue off the producer's line
+    char m_padding[kCacheLine - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    // Room for at least `n` more elements, as far as the producer can tell
+    bool HasRoom(size_t tail, size_t n) {
+        if (tail - m_cached_head + n <= m_mask + 1) {
+            return true;
+        }
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        return tail - m_cached_head + n <= m_mask + 1;
+    }
+
+    // Number of elements ready for the consumer
+    size_t Available(size_t head) {
+        if (m_cached_tail == head) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+        }
+        return m_cached_tail - head;
+    }
+
+   public:
+    // `capacity` is rounded up to the next power of two.
+    explicit SpscQueue(size_t capacity) {
+        if (capacity < 2) {
+            capacity = 2;
+        }
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+
+        m_cells.reset(new Cell[size]);
+        m_mask = size - 1;
+    }
+
+    ~SpscQueue() {
+        size_t end = m_tail.load(std::memory_order_relaxed);
+        for (size_t pos = m_head.load(std::memory_order_relaxed); pos != end; ++pos) {
+            m_cells[pos & m_mask].Element()->~T();
+        }
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    // Producer only. Returns false if the queue is full. `t` is only moved from on success.
+    bool TryPush(T &&t) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (!HasRoom(tail, 1)) {
+            return false;
+        }
+
+        new (m_cells[tail & m_mask].storage) T(std::move(t));
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool TryPop(T &t) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (Available(head) == 0) {
+            return false;
+        }
+
+        T *element = m_cells[head & m_mask].Element();
+        t = std::move(*element);
+        element->~T();
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*
+    Producer only. Moves elements from [first, last) into the queue in order until it is full and publishes them all
+    at once. Returns how many were pushed, those are the first n of the range.
+    */
+    template <typename It>
+    size_t TryPushBatch(It first, It last) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t pushed = 0;
+        for (; first != last && HasRoom(tail + pushed, 1); ++first, ++pushed) {
+            new (m_cells[(tail + pushed) & m_mask].storage) T(std::move(*first));
+        }
+        if (pushed > 0) {
+            m_tail.store(tail + pushed, std::memory_order_release);
+        }
+        return pushed;
+    }
+
+    // Consumer only. Pops up to `max` elements into `out` (e.g. a std::back_inserter). Returns how many were popped.
+    template <typename OutputIt>
+    size_t TryPopBatch(OutputIt out, size_t max) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t available = Available(head);
+        size_t popped = available < max ? available : max;
+        for (size_t i = 0; i < popped; ++i) {
+            T *element = m_cells[(head + i) & m_mask].Element();
+            *out++ = std::move(*element);
+            element->~T();
+        }
+        if (popped > 0) {
+            m_head.store(head + popped, std::memory_order_release);
+        }
+        return popped;
+    }
+
+    // Approximate unless called by the producer or the consumer.
+    size_t Size() const {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t Capacity() const { return m_mask + 1; }
+};
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Lazily started coroutine returning a T. Nothing runs until the task is awaited (or handed to Spawn()), and once it
+ * finishes it resumes whoever awaited it, on whatever thread it finished on.
+ *
+ *   Task<bool> Write(...) {
+ *       bool ok = co_await client.UpsertEdgesAsync(edges, scheduler);
+ *       co_return ok;
+ *   }
+ *
+ * A task's frame may outlive the statement that created it, so coroutines should take their arguments by value unless
+ * the caller keeps them alive until the task is done.
+ **/
+template <typename T = void>
+class Task;
+
+namespace task_detail {
+
+class PromiseBase {
+   public:
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Hands the thread straight over to the awaiting coroutine instead of nesting it on the stack
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> done) noexcept {
+            std::coroutine_handle<> continuation = done.promise().m_continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() { m_error = std::current_exception(); }
+
+    std::coroutine_handle<> m_continuation;
+    std::exception_ptr m_error;
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+   public:
+    Task<T> get_return_object();
+    void return_value(T value) { m_value.emplace(std::move(value)); }
+
+    T Result() {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        return std::move(*m_value);
+    }
+
+   private:
+    std::optional<T> m_value;
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+   public:
+    Task<void> get_return_object();
+    void return_void() {}
+
+    void Result() {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+};
+
+/*
+Eagerly started, self destroying coroutine. Only used below to start tasks from code that isn't a coroutine itself.
+*/
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+}  // namespace task_detail
+
+template <typename T>
+class Task {
+   public:
+    using promise_type = task_detail::Promise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    // Starts the task and suspends the awaiting coroutine until it is done. Rethrows what the task threw.
+    auto operator co_await() noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().m_continuation = awaiting;
+                return handle;
+            }
+            T await_resume() { return handle.promise().Result(); }
+        };
+        return Awaiter{m_handle};
+    }
+
+   private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace task_detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+// Runs `task` to completion and delivers the outcome through `done`.
+template <typename T>
+Detached Deliver(Task<T> task, std::promise<T> done) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await task;
+            done.set_value();
+        } else {
+            done.set_value(co_await task);
+        }
+    } catch (...) {
+        done.set_exception(std::current_exception());
+    }
+}
+
+// Runs `task` to completion and hands the outcome to `on_done`, on whichever thread the task finished on.
+template <typename T, typename Done>
+Detached Continue(Task<T> task, Done on_done) {
+    std::exception_ptr error;
+    if constexpr (std::is_void_v<T>) {
+        try {
+            co_await task;
+        } catch (...) {
+            error = std::current_exception();
+        }
+        on_done(error);
+    } else {
+        T result{};
+        try {
+            result = co_await task;
+        } catch (...) {
+            error = std::current_exception();
+        }
+        on_done(error, std::move(result));
+    }
+}
+
+}  // namespace task_detail
+
+/*
+Starts `task` from outside of a coroutine. It runs on the calling thread up to its first suspension point and is
+resumed from wherever it is completed (e.g. the RpcScheduler's threads), so it finishes without the help of whoever
+waits for the future.
+*/
+template <typename T>
+std::future<T> Spawn(Task<T> task) {
+    std::promise<T> done;
+    std::future<T> future = done.get_future();
+    task_detail::Deliver(std::move(task), std::move(done));
+    return future;
+}
+
+/*
+Starts `task` like the above, but instead of a future to wait for calls `on_done(error, result)` (`on_done(error)` for
+a Task<void>) once it is done, on the thread that finished it. `error` is null unless the task threw, `result` is
+default constructed then. This is the form to use on the Executor's threads, which must never block on a task.
+*/
+template <typename T, typename Done>
+void Spawn(Task<T> task, Done on_done) {
+    task_detail::Continue(std::move(task), std::move(on_done));
+}
+
+// Blocks the calling thread until `task` is done. Never call it from a thread the task needs to make progress.
+template <typename T>
+T SyncWait(Task<T> task) {
+    return Spawn(std::move(task)).get();
+}
+
+/*
+Runs all `tasks` concurrently and completes once every one of them has, with their results in the same order. If any
+of them threw, the first exception is rethrown once they are all done.
+*/
+template <typename T>
+Task<std::vector<T>> WhenAll(std::vector<Task<T>> tasks) {
+    struct Join {
+        std::vector<Task<T>>& tasks;
+        std::vector<std::optional<T>> results;
+        std::atomic<size_t> remaining;
+        std::exception_ptr error;
+        std::atomic_flag failed;
+        std::coroutine_handle<> parent;
+
+        static task_detail::Detached Run(Join* join, size_t i) {
+            try {
+                join->results[i].emplace(co_await join->tasks[i]);
+            } catch (...) {
+                if (!join->failed.test_and_set()) {
+                    join->error = std::current_exception();
+                }
+            }
+            if (join->remaining.fetch_sub(1) == 1) {
+                join->parent.resume();
+            }
+        }
+
+        bool await_ready() const noexcept { return tasks.empty(); }
+
+        // The extra count held here keeps the parent from being resumed before all tasks have been started
+        bool await_suspend(std::coroutine_handle<> awaiting) {
+            parent = awaiting;
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                Run(this, i);
+            }
+            return remaining.fetch_sub(1) != 1;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    Join join{tasks, std::vector<std::optional<T>>(tasks.size()), tasks.size() + 1, nullptr, {}, nullptr};
+    co_await join;
+    if (join.error) {
+        std::rethrow_exception(join.error);
+    }
+
+    std::vector<T> results;
+    results.reserve(join.results.size());
+    for (auto& result : join.results) {
+        results.emplace_back(std::move(*result));
+    }
+    co_return results;
+}
+
+#endif
@@ -1,58 +1,69 @@
 #ifndef THREAD_DISPATCHER_H
 #define THREAD_DISPATCHER_H
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <thread>
 
 #include "data_source.h"
+#include "executor.h"
 #include "logging/log_signal.h"
 
 class SignalChannel;
 
+/**
+ * Polls a DataSource until shutdown, either on a thread of its own or as a series of steps on a shared Executor.
+ **/
 class ThreadDispatcher {
    private:
+    // First wait after a source went idle. It doubles with every further idle step.
+    static constexpr std::chrono::microseconds kMinBackoff{50};
+
+    /*
+    Polling on an executor: each step is one Poll(), posted again right away while the source is busy and after the
+    backoff (or on Notify) when it is idle. At most one step is queued or running at any time, so the source is never
+    polled concurrently. Steps and timers hold on to this state, it outlives the dispatcher if it has to.
+    */
+    struct Steps : std::enable_shared_from_this<Steps> {
+        std::shared_ptr<DataSource> producer;
+        std::shared_ptr<SignalChannel> sig_channel;
+        std::shared_ptr<LogSignal> log_signal;
+        Executor* executor;  // outlives us, see the constructor
+        std::chrono::microseconds min_backoff;
+        std::chrono::microseconds max_backoff;
+        std::chrono::microseconds backoff;
+        std::atomic<bool> scheduled = false;
+        std::atomic<bool> notified = false;
+        std::atomic<bool> stopping = false;
+        std::promise<void> stopped;
+
+        // Queue a step unless one is queued or running already
+        void Kick() {
+            if (!scheduled.exchange(true)) {
+                executor->Post([self = shared_from_this()]() { self->Step(); });
+            }
+        }
+
+        void Step();
+    };
+
     std::shared_ptr<DataSource> m_producer;
-    std::thread m_thread;
     std::shared_ptr<SignalChannel> m_sig_channel;
     std::shared_ptr<LogSignal> m_log_signal;
+    std::shared_ptr<Executor> m_executor;
+    std::shared_ptr<Steps> m_steps;
+    // Declared last: the thread starts running Loop() as soon as it is constructed, so everything above must be set.
+    std::thread m_thread;
 
     static void Loop(ThreadDispatcher *self) {
         std::shared_ptr<DataSource> producer = self->m_producer;
+        auto max_backoff = std::chrono::microseconds(std::chrono::milliseconds(producer->NextPollInterval()));
+        auto min_backoff = std::min(kMinBackoff, max_backoff);
+        auto backoff = max_backoff;
         while (!self->m_sig_channel->m_shutdown_requested.load()) {
-            {
-                /*
-                Without blocks log_lock doesn't release until the iteration ends. Right after that iteration ends,
-                it starts the next one. This means, we only have time between the destruction of lock and then
-                the initialization of lock in the next iteration. Since that happens as basically the next
-                instruction there basically isn't any time for anyone else to acquire a lock on the mutex.
-                */
-
-                // Lock first, then check predicate, if false unlock and then wait
-                std::unique_lock lock(self->m_sig_channel->m_cv_mutex);
-
-                /*
-                When it wakes up it tries to re-lock the mutex and check the
-                predicate.
-                */
-                self->m_sig_channel->m_cv.wait_for(lock,
-                                                   // wait for up to 5 milliseconds
-                                                   std::chrono::milliseconds(5),
-
-                                                   // when the condition variable is woken up and this predicate
-                                                   // returns true, the wait is stopped:
-                                                   [&self]() {
-                                                       bool stop_waiting =
-                                                           self->m_sig_channel->m_shutdown_requested.load();
-                                                       return stop_waiting;
-                                                   });
-
-                if (self->m_sig_channel->m_shutdown_requested.load()) {
-                    break;
-                }
-            }  // wait() reacquired the lock on exit. So we release it here since there is no reason to hold it while
-               // polling.
-
             /*
             Atomic since we are modifying it from multiple processors and we want it to be be threadsafe.
 
@@ -70,7 +81,7 @@ class ThreadDispatcher {
                 std::unique_lock lock(self->m_log_signal->m_log_mutex);
                 self->m_log_signal->active_processors.fetch_add(1);
             }
-            producer->Poll();
+            bool more = producer->Poll();
             /*
             Why do we protect writes to shared var even if it is atomic?
             There could be problems if write to shared variable happens between checking it in predicate and waiting on
@@ -88,8 +99,21 @@ class ThreadDispatcher {
                 std::unique_lock lock(self->m_log_signal->m_log_mutex);
                 self->m_log_signal->active_processors.fetch_add(-1);
             }
-            auto delay = std::chrono::milliseconds(producer->NextPollInterval());
-            std::this_thread::sleep_for(delay);
+
+            /*
+            Busy: go again right away. Idle: wait for the producer to notify us, a little longer after every idle
+            step so a quiet source doesn't cost wakeups, but never longer than its poll interval. A source may change
+            that interval as it goes.
+            */
+            max_backoff = std::chrono::microseconds(std::chrono::milliseconds(producer->NextPollInterval()));
+            min_backoff = std::min(kMinBackoff, max_backoff);
+            if (more) {
+                backoff = min_backoff;
+            } else if (producer->WaitReady(backoff)) {
+                backoff = min_backoff;
+            } else {
+                backoff = std::min(backoff * 2, max_backoff);
+            }
         }
         std::cout << "ThreadDispatcher shutting down:" << self->m_sig_channel->m_shutdown_requested.load() << std::endl;
         producer->Stop();
@@ -100,7 +124,104 @@ class ThreadDispatcher {
                               std::shared_ptr<LogSignal> log_signal)
         : m_producer(p), m_sig_channel(s), m_log_signal(log_signal), m_thread(Loop, this) {}
 
-    ~ThreadDispatcher() { m_thread.join(); }
+    // Polls `p` on `executor` instead of a thread of its own. The executor must outlive the dispatcher.
+    explicit ThreadDispatcher(std::shared_ptr<DataSource> p, std::shared_ptr<SignalChannel> s,
+                              std::shared_ptr<LogSignal> log_signal, std::shared_ptr<Executor> executor)
+        : m_producer(p),
+          m_sig_channel(s),
+          m_log_signal(log_signal),
+          m_executor(executor),
+          m_steps(std::make_shared<Steps>()) {
+        m_steps->producer = p;
+        m_steps->sig_channel = s;
+        m_steps->log_signal = log_signal;
+        m_steps->executor = executor.get();
+        m_steps->max_backoff = std::chrono::microseconds(std::chrono::milliseconds(p->NextPollInterval()));
+        m_steps->min_backoff = std::min(kMinBackoff, m_steps->max_backoff);
+        m_steps->backoff = m_steps->max_backoff;
+
+        std::weak_ptr<Steps> steps = m_steps;
+        m_producer->OnNotify([steps]() {
+            if (auto self = steps.lock()) {
+                self->notified.store(true);
+                self->Kick();
+            }
+        });
+        m_steps->Kick();
+    }
+
+    ~ThreadDispatcher() {
+        if (m_steps) {
+            m_steps->stopping.store(true);
+            std::future<void> stopped = m_steps->stopped.get_future();
+            m_producer->Notify();
+            stopped.wait();
+            return;
+        }
+
+        // Don't make shutdown wait for the rest of a backoff
+        m_producer->Notify();
+        m_thread.join();
+    }
 };
 
-#endif
\ No newline at end of file
+/*
+Same bookkeeping and backoff as Loop(), one poll at a time.
+*/
+inline void ThreadDispatcher::Steps::Step() {
+    if (stopping.load() || sig_channel->m_shutdown_requested.load()) {
+        // `scheduled` stays set, nothing gets queued after this
+        std::cout << "ThreadDispatcher shutting down:" << sig_channel->m_shutdown_requested.load() << std::endl;
+        producer->Stop();
+
+        // The dispatcher releases the source, not whichever pool thread happens to drop this step last
+        producer.reset();
+        stopped.set_value();
+        return;
+    }
+
+    // This poll covers whatever we were notified about so far
+    if (notified.exchange(false)) {
+        backoff = min_backoff;
+    }
+
+    {
+        std::unique_lock lock(log_signal->m_log_mutex);
+        log_signal->active_processors.fetch_add(1);
+    }
+    bool more = producer->Poll();
+    {
+        std::unique_lock lock(log_signal->m_log_mutex);
+        log_signal->active_processors.fetch_add(-1);
+    }
+
+    max_backoff = std::chrono::microseconds(std::chrono::milliseconds(producer->NextPollInterval()));
+    min_backoff = std::min(kMinBackoff, max_backoff);
+    if (more) {
+        backoff = min_backoff;
+        executor->Post([self = shared_from_this()]() { self->Step(); });
+        return;
+    }
+
+    /*
+    Idle. Once `scheduled` is released the next step may start at any time, so everything it reads has to be settled
+    before that.
+    */
+    auto wait = backoff;
+    backoff = std::min(backoff * 2, max_backoff);
+    scheduled.store(false);
+
+    // Weak, a pending timer must not keep a stopped dispatcher alive
+    executor->PostAfter(wait, [steps = weak_from_this()]() {
+        if (auto self = steps.lock()) {
+            self->Kick();
+        }
+    });
+
+    // Notified while we were polling, its Kick() found us still scheduled
+    if (notified.load()) {
+        Kick();
+    }
+}
+
+#endif
@@ -16,6 +16,7 @@
  *
  */
 
+#include <grpc/compression.h>
 #include <grpc/grpc.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/server_credentials.h>
@@ -26,18 +27,30 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <exception>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 
+#include "../channel_pool.h"
 #include "../config/config_parser.h"
 #include "../graph/helper.h"
 #include "../graph/in_memory_graph.h"
-#include "../grpc/graph.grpc.pb.h"
+#include "../graph/search_results.h"
+#include "graph.grpc.pb.h"
+#include "../rpc_scheduler.h"
+#include "../task.h"
 #include "worker_graph_client.h"
 
 using grpc::Server;
+using grpc::ServerAsyncResponseWriter;
 using grpc::ServerBuilder;
+using grpc::ServerCompletionQueue;
 using grpc::ServerContext;
 using grpc::ServerReader;
 using grpc::ServerReaderWriter;
@@ -62,15 +75,35 @@ using grpc::ClientReaderWriter;
 using grpc::ClientWriter;
 using grpc::Status;
 
-class GraphImpl final : public Graph::Service {
+/**
+ * Search is served asynchronously on the completion queue threads of an RpcScheduler, see ServeSearches(). A search
+ * waiting for remote hops is a suspended coroutine, not a blocked thread, so searches fanning in from other workers
+ * can't exhaust the threads and deadlock. The write and admin methods are synchronous.
+ **/
+class GraphImpl final : public Graph::WithAsyncMethod_Search<Graph::Service> {
    public:
     using InMemoryGraphType = InMemoryGraph<std::string, std::string>;
 
-    explicit GraphImpl(const std::string& id) : graph_(InMemoryGraph<std::string, std::string>(id)) {}
+    // Search results of kCompressMinBytes and more are sent compressed with `compression`, if any
+    static constexpr size_t kCompressMinBytes = 16 * 1024;
 
+    GraphImpl(const std::string& id, size_t channels_per_host, grpc_compression_algorithm compression)
+        : graph_(InMemoryGraph<std::string, std::string>(id)),
+          channels_per_host_(channels_per_host),
+          compression_(compression),
+          instance_(std::to_string(std::random_device{}()) + "-" +
+                    std::to_string(std::chrono::system_clock::now().time_since_epoch().count())) {}
+
+    // Starts connecting to the host right away, so the first remote hops don't wait for the handshakes
     Status AddHost(ServerContext* context, const Host* request, ::google::protobuf::Empty* response) override {
-        rpc_clients_.insert({request->key(), WorkerGraphClient(grpc::CreateChannel(
-                                                 request->address(), grpc::InsecureChannelCredentials()))});
+        auto channels = std::make_shared<ChannelPool<Graph>>(request->address(), channels_per_host_);
+        channels->Connect();
+
+        // Searches keep using the map they started with, the new one is a copy
+        std::unique_lock lock(rpc_clients_mutex_);
+        auto clients = std::make_shared<RpcClients>(*rpc_clients_);
+        clients->insert({request->key(), WorkerGraphClient(channels)});
+        rpc_clients_ = std::move(clients);
         return Status::OK;
     }
 
@@ -110,58 +143,140 @@ class GraphImpl final : public Graph::Service {
         return Status::OK;
     }
 
-    Status Search(ServerContext* context, const SearchArgs* request, SearchResults* response) override {
-        std::set<graph::Vertex> result_nodes;
-        std::set<graph::Edge> result_edges;
-        std::set<std::string> ids_so_far;
+    Status UpsertEdges(ServerContext* context, ServerReader<Edge>* reader, GraphSummary* response) override {
+        Edge edge;
+        while (reader->Read(&edge)) {
+            graph_.UpsertEdge(edge.from(), edge.to(), edge.label(), edge.lookup_to());
+        }
+        response->set_vertex_count(graph_.NumberOfVertices());
+        response->set_edge_count(graph_.NumberOfEdges());
+        return Status::OK;
+    }
 
-        for (const auto& v : request->vertices()) {
-            result_nodes.insert(v);
+    /*
+    Streams the keys of all local vertices. Used by the orchestrator to seed its cache of known vertices, so values
+    are left out.
+    */
+    Status ListVertices(ServerContext* context, const ::google::protobuf::Empty* request,
+                        ServerWriter<Vertex>* writer) override {
+        Vertex vertex;
+        for (const auto& key : graph_.Keys()) {
+            vertex.set_key(key);
+            if (!writer->Write(vertex)) {
+                break;
+            }
         }
+        return Status::OK;
+    }
 
-        for (const auto& e : request->edges()) {
-            result_edges.insert(e);
+    Status Ping(ServerContext* context, const PingRequest* request, PingResponse* response) override {
+        response->set_data("I'm alive!");
+        response->set_instance(instance_);
+        return Status::OK;
+    }
+
+    /*
+    Starts taking searches from `cq`, the queue `scheduler` polls. One call is waited for per scheduler thread, and
+    each call that comes in waits for the next one before it is served. Stops once the queue shuts down.
+    */
+    void ServeSearches(ServerCompletionQueue* cq, RpcScheduler& scheduler) {
+        for (size_t i = 0; i < scheduler.Size(); ++i) {
+            Spawn(ServeSearch(cq, scheduler));
+        }
+    }
+
+   private:
+    InMemoryGraphType graph_;
+    using RpcClients = std::map<std::string, WorkerGraphClient>;
+    std::shared_ptr<const RpcClients> rpc_clients_ = std::make_shared<RpcClients>();  // replaced by AddHost
+    std::shared_mutex rpc_clients_mutex_;
+    size_t channels_per_host_;
+    grpc_compression_algorithm compression_;
+    std::string instance_;  // see PingResponse
+
+    /*
+    The request, the response and the results of the remote hops all live on the arena of `results`, which is freed
+    in one go once the response is sent.
+    */
+    Task<void> ServeSearch(ServerCompletionQueue* cq, RpcScheduler& scheduler) {
+        ServerContext context;
+        graph::SearchResultBuilder results;
+        SearchArgs* request = results.Create<SearchArgs>();
+        ServerAsyncResponseWriter<SearchResults> responder(&context);
+        if (!co_await RpcScheduler::Completes(
+                [&](void* tag) { RequestSearch(&context, request, &responder, cq, cq, tag); })) {
+            co_return;  // shutting down
         }
+        Spawn(ServeSearch(cq, scheduler));
 
-        for (const auto& v : request->ids_so_far()) {
-            ids_so_far.insert(v);
+        Status status = Status::OK;
+        try {
+            co_await Search(*request, results, scheduler);
+        } catch (const std::exception& e) {
+            results.Results().Clear();
+            status = Status(grpc::StatusCode::INTERNAL, e.what());
         }
+        // Small results aren't worth the CPU
+        if (compression_ != GRPC_COMPRESS_NONE && results.Results().ByteSizeLong() >= kCompressMinBytes) {
+            context.set_compression_algorithm(compression_);
+        }
+        co_await RpcScheduler::Completes([&](void* tag) { responder.Finish(results.Results(), status, tag); });
+    }
 
-        graph_.Search(request->start_key(), request->level(), result_nodes, result_edges, ids_so_far, rpc_clients_);
+    Task<void> Search(const SearchArgs& request, graph::SearchResultBuilder& results, RpcScheduler& scheduler) {
+        std::set<std::string> ids_so_far;
+        results.SetUndirected(request.undirected());
 
-        // Collect the final results from the BFS Search
-        for (const auto& v : result_nodes) {
-            graph::Vertex* vertex = response->add_vertices();
-            *vertex = v;
+        for (const auto& v : request.vertices()) {
+            results.Add(v);
         }
 
-        for (const auto& e : result_edges) {
-            Edge* edge = response->add_edges();
-            *edge = e;
+        for (const auto& e : request.edges()) {
+            results.Add(e);
         }
 
-        return Status::OK;
-    }
+        for (const auto& v : request.ids_so_far()) {
+            ids_so_far.insert(v);
+        }
 
-    Status Ping(ServerContext* context, const PingRequest* request, PingResponse* response) override {
-        response->set_data("I'm alive!");
-        return Status::OK;
-    }
+        InMemoryGraphType::SearchStarts starts;
+        if (request.starts().empty()) {
+            starts.emplace_back(request.start_key(), request.level());
+        }
+        for (const auto& start : request.starts()) {
+            starts.emplace_back(start.key(), start.level());
+        }
 
-   private:
-    InMemoryGraphType graph_;
-    std::map<std::string, WorkerGraphClient> rpc_clients_;
+        std::shared_ptr<const RpcClients> rpc_clients;
+        {
+            std::shared_lock lock(rpc_clients_mutex_);
+            rpc_clients = rpc_clients_;
+        }
+        co_await graph_.Search(std::move(starts), results, ids_so_far, *rpc_clients, scheduler);
+    }
 };
 
-void RunServer(const int port) {
+/*
+`threads` poll the completion queue the searches are served on, including their remote hops. The synchronous methods
+run on gRPC's own pool. Remote hops go over `channels_per_host` connections to every other worker. Big search results
+are compressed with `compression`.
+*/
+void RunServer(const int port, size_t threads, size_t channels_per_host, grpc_compression_algorithm compression) {
     std::string server_address("0.0.0.0:" + std::to_string(port));
-    GraphImpl service("localhost:" + std::to_string(port));
+    GraphImpl service("localhost:" + std::to_string(port), channels_per_host, compression);
 
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
+    std::unique_ptr<ServerCompletionQueue> cq = builder.AddCompletionQueue();
+    ServerCompletionQueue* search_queue = cq.get();
+
+    // Declared before the server so it is destroyed after it, the queue may only shut down once the server has
+    RpcScheduler scheduler(std::move(cq), threads);
     std::unique_ptr<Server> server(builder.BuildAndStart());
-    std::cout << "[Worker] Listening on " << server_address << std::endl;
+    service.ServeSearches(search_queue, scheduler);
+    std::cout << "[Worker] Listening on " << server_address << " with " << scheduler.Size() << " search threads"
+              << std::endl;
     server->Wait();
 }
 
@@ -185,6 +300,26 @@ int main(int argc, char* argv[]) {
     ConfigParser& config = ConfigParser::instance(config_file);
     std::map<std::string, std::string> server_config = config.Server();
     int listen_port = atoi(server_config.at("port").c_str());
-    RunServer(listen_port);
+
+    size_t threads = server_config.count("threads") ? std::stoul(server_config["threads"]) : 0;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    size_t channels_per_host =
+        server_config.count("channels_per_worker") ? std::stoul(server_config["channels_per_worker"]) : 1;
+
+    std::string compression_name = server_config.count("compression") ? server_config["compression"] : "none";
+    grpc_compression_algorithm compression = GRPC_COMPRESS_NONE;
+    if (compression_name == "gzip") {
+        compression = GRPC_COMPRESS_GZIP;
+    } else if (compression_name == "deflate") {
+        compression = GRPC_COMPRESS_DEFLATE;
+    } else if (compression_name != "none") {
+        std::cerr << "[Worker] Unknown compression '" << compression_name << "', sending search results uncompressed"
+                  << std::endl;
+    }
+
+    RunServer(listen_port, threads, channels_per_host, compression);
     return 0;
 }
@@ -1,10 +1,14 @@
 #include "worker_graph_client.h"
 
-SearchArgs WorkerGraphClient::MakeSearchArgs(std::string key, int level,
+SearchArgs WorkerGraphClient::MakeSearchArgs(const std::vector<std::pair<std::string, int>>& starts, bool undirected,
                                              const std::set<std::string>& ids_so_far) const {
     graph::SearchArgs a;
-    a.set_start_key(key);
-    a.set_level(level);
+    a.set_undirected(undirected);
+    for (const auto& [key, level] : starts) {
+        graph::SearchStart* start = a.add_starts();
+        start->set_key(key);
+        start->set_level(level);
+    }
     for (const auto& i : ids_so_far) {
         std::string* id = a.add_ids_so_far();
         *id = i;
@@ -13,35 +17,32 @@ SearchArgs WorkerGraphClient::MakeSearchArgs(std::string key, int level,
     return a;
 }
 
-void WorkerGraphClient::UpdateNodes(const SearchResults& result, std::set<graph::Vertex>& nodes) const {
-    for (const auto& v : result.vertices()) {
-        nodes.insert(v);
-    }
-}
-
-void WorkerGraphClient::UpdateEdges(const SearchResults& result, std::set<graph::Edge>& edges) const {
-    for (const auto& e : result.edges()) {
-        edges.insert(e);
-    }
-}
-
 void WorkerGraphClient::UpdateIdsSoFar(const SearchResults& result, std::set<std::string>& ids_so_far) const {
-    for (const auto& v : result.ids_so_far()) {
-        ids_so_far.insert(v);
+    for (uint32_t v : result.ids_so_far()) {
+        ids_so_far.insert(result.keys(v));
     }
 }
 
-void WorkerGraphClient::Search(const std::string& key, const int level, std::set<graph::Vertex>& result_nodes,
-                               std::set<graph::Edge>& result_edges, std::set<std::string>& ids_so_far) const {
+Task<bool> WorkerGraphClient::SearchAsync(std::vector<std::pair<std::string, int>> starts, bool undirected,
+                                          SearchResults& result, std::set<std::string>& ids_so_far,
+                                          RpcScheduler& scheduler) const {
     ClientContext context;
-    SearchResults result;
-    SearchArgs args = MakeSearchArgs(key, level, ids_so_far);
-    Status status = stub_->Search(&context, args, &result);
+    context.set_deadline(std::chrono::system_clock::now() + kSearchTimeout);
+    SearchArgs args = MakeSearchArgs(starts, undirected, ids_so_far);
+    Status status;
+
+    std::unique_ptr<grpc::ClientAsyncResponseReader<SearchResults>> reader(
+        channels_->Next()->PrepareAsyncSearch(&context, args, scheduler.Queue()));
+    reader->StartCall();
+    co_await RpcScheduler::Completes([&](void* tag) { reader->Finish(&result, &status, tag); });
+    if (status.ok() && !graph::IsValid(result)) {
+        result.Clear();
+        status = Status(grpc::StatusCode::DATA_LOSS, "Malformed search results");
+    }
     if (!status.ok()) {
         std::cerr << "Search rpc failed." << std::endl;
     } else {
-        UpdateNodes(result, result_nodes);
-        UpdateEdges(result, result_edges);
         UpdateIdsSoFar(result, ids_so_far);
     }
+    co_return status.ok();
 }
\ No newline at end of file
@@ -7,10 +7,19 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <chrono>
 #include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "../channel_pool.h"
 #include "../graph/helper.h"
-#include "../grpc/graph.grpc.pb.h"
+#include "../graph/search_results.h"
+#include "graph.grpc.pb.h"
+#include "../rpc_scheduler.h"
+#include "../task.h"
 
 using graph::Graph;
 using graph::SearchArgs;
@@ -22,18 +31,27 @@ using grpc::Status;
 
 class WorkerGraphClient {
    private:
-    SearchArgs MakeSearchArgs(std::string key, int level, const std::set<std::string>& ids_so_far) const;
-    void UpdateNodes(const SearchResults& result, std::set<graph::Vertex>& nodes) const;
-    void UpdateEdges(const SearchResults& result, std::set<graph::Edge>& edges) const;
+    SearchArgs MakeSearchArgs(const std::vector<std::pair<std::string, int>>& starts, bool undirected,
+                              const std::set<std::string>& ids_so_far) const;
     void UpdateIdsSoFar(const SearchResults& result, std::set<std::string>& ids_so_far) const;
 
    public:
-    WorkerGraphClient(std::shared_ptr<Channel> channel) : stub_(Graph::NewStub(channel)) {}
-    void Search(const std::string& key, const int level, std::set<graph::Vertex>& result_nodes,
-                std::set<graph::Edge>& result_edges, std::set<std::string>& ids_so_far) const;
+    // Deadline of a remote hop. The orchestrator gives up on the whole search after the same time.
+    static constexpr std::chrono::seconds kSearchTimeout{30};
+
+    WorkerGraphClient(std::shared_ptr<ChannelPool<Graph>> channels) : channels_(channels) {}
+
+    /*
+    Continues a search on the worker from all of `starts`, each with the levels left there, in a graph that is
+    `undirected` or not (see graph::EdgeKey()). What it found is parsed straight into `result`, so put that on the arena of
+    the search (SearchResultBuilder::Create()). Completes on one of `scheduler`'s threads without blocking one while
+    the worker searches. `result` and `ids_so_far` must outlive the task. Returns whether the call succeeded.
+    */
+    Task<bool> SearchAsync(std::vector<std::pair<std::string, int>> starts, bool undirected, SearchResults& result,
+                           std::set<std::string>& ids_so_far, RpcScheduler& scheduler) const;
 
    private:
-    std::unique_ptr<graph::Graph::Stub> stub_;
+    std::shared_ptr<ChannelPool<Graph>> channels_;  // calls go round robin over its channels
 };
 
 #endif
\ No newline at end of file